@@ -21,6 +21,7 @@
 #include "val/include/acs_val.h"
 #include "val/include/acs_memory.h"
 #include "val/include/acs_dma.h"
+#include "val/include/rule_based_execution.h"
 #include "acs.h"
 
 void
@@ -32,7 +33,9 @@ createIoVirtInfoTable(
                     + ((IOVIRT_ITS_COUNT + IOVIRT_SMMUV3_COUNT + IOVIRT_RC_COUNT
                     + IOVIRT_SMMUV2_COUNT + IOVIRT_NAMED_COMPONENT_COUNT + IOVIRT_PMCG_COUNT)
                     * sizeof(IOVIRT_BLOCK)) + (IOVIRT_MAX_NUM_MAP * sizeof(ID_MAP))));
+  rule_profile_phase_begin("IOVIRT");
   val_iovirt_create_info_table(IoVirtInfoTable);
+  rule_profile_phase_end();
 }
 
 
@@ -43,7 +46,9 @@ createPcieInfoTable(
   uint64_t   *PcieInfoTable;
   PcieInfoTable = val_aligned_alloc(SIZE_4K, (sizeof(PCIE_INFO_TABLE)
                   + (PLATFORM_OVERRIDE_NUM_ECAM * sizeof(PCIE_INFO_BLOCK))));
+  rule_profile_phase_begin("PCIE");
   val_pcie_create_info_table(PcieInfoTable);
+  rule_profile_phase_end();
 }
 
 void createMemoryInfoTable(
@@ -52,7 +57,9 @@ void createMemoryInfoTable(
   uint64_t   *MemoryInfoTable;
   MemoryInfoTable = val_aligned_alloc(SIZE_4K, sizeof(MEMORY_INFO_TABLE)
                     + (PLATFORM_OVERRIDE_MEMORY_ENTRY_COUNT * sizeof(MEM_INFO_BLOCK)));
+  rule_profile_phase_begin("MEMORY");
   val_memory_create_info_table(MemoryInfoTable);
+  rule_profile_phase_end();
 }
 
 void
@@ -64,7 +71,9 @@ createSmbiosInfoTable(
     SmbiosInfoTable = val_aligned_alloc(SIZE_4K, sizeof(PE_SMBIOS_PROCESSOR_INFO_TABLE) +
                             (PLATFORM_OVERRIDE_SMBIOS_SLOT_COUNT * sizeof(PE_SMBIOS_TYPE4_INFO)));
 
+    rule_profile_phase_begin("SMBIOS");
     val_smbios_create_info_table(SmbiosInfoTable);
+    rule_profile_phase_end();
 }
 
 uint32_t
@@ -77,7 +86,9 @@ createPeInfoTable(
     PeInfoTable = val_aligned_alloc(SIZE_4K, sizeof(PE_INFO_TABLE) +
                                     (PLATFORM_OVERRIDE_PE_CNT * sizeof(PE_INFO_ENTRY)));
 
+    rule_profile_phase_begin("PE");
     Status = val_pe_create_info_table(PeInfoTable);
+    rule_profile_phase_end();
 
     return Status;
 }
@@ -96,7 +107,9 @@ createGicInfoTable(
                     + PLATFORM_OVERRIDE_GICC_COUNT + PLATFORM_OVERRIDE_GICD_COUNT
                     + gic_info_end_index) * sizeof(GIC_INFO_ENTRY)));
 
+    rule_profile_phase_begin("GIC");
     Status = val_gic_create_info_table(GicInfoTable);
+    rule_profile_phase_end();
 
     return Status;
 }
@@ -110,7 +123,9 @@ createTimerInfoTable(
     TimerInfoTable = val_aligned_alloc(SIZE_4K, sizeof(TIMER_INFO_TABLE)
                     + (PLATFORM_OVERRIDE_TIMER_COUNT * sizeof(TIMER_INFO_GTBLOCK)));
 
+    rule_profile_phase_begin("TIMER");
     val_timer_create_info_table(TimerInfoTable);
+    rule_profile_phase_end();
 }
 
 void
@@ -122,7 +137,9 @@ createWatchdogInfoTable(
     WdInfoTable = val_aligned_alloc(SIZE_4K, sizeof(WD_INFO_TABLE)
                     + (PLATFORM_OVERRIDE_WD_TIMER_COUNT * sizeof(WD_INFO_BLOCK)));
 
+    rule_profile_phase_begin("WATCHDOG");
     val_wd_create_info_table(WdInfoTable);
+    rule_profile_phase_end();
 }
 
 void
@@ -132,7 +149,9 @@ createCxlInfoTable()
 
     CxlInfoTable = val_aligned_alloc(SIZE_4K, (sizeof(CXL_INFO_TABLE)
                     + (PLATFORM_OVERRIDE_CXL_COUNT * sizeof(CXL_INFO_BLOCK))));
+    rule_profile_phase_begin("CXL");
     val_cxl_create_info_table(CxlInfoTable);
+    rule_profile_phase_end();
 }
 
 void
@@ -146,11 +165,15 @@ createPeripheralInfoTable(
     PeripheralInfoTable = val_aligned_alloc(SIZE_4K, sizeof(PERIPHERAL_INFO_TABLE)
                             + ((PLATFORM_OVERRIDE_PERIPHERAL_COUNT + per_info_end_index)
                                 * sizeof(PERIPHERAL_INFO_BLOCK)));
+    rule_profile_phase_begin("PERIPHERAL");
     val_peripheral_create_info_table(PeripheralInfoTable);
+    rule_profile_phase_end();
 
     MemoryInfoTable = val_aligned_alloc(SIZE_4K, sizeof(MEMORY_INFO_TABLE)
                         + (PLATFORM_OVERRIDE_MEMORY_ENTRY_COUNT * sizeof(MEM_INFO_BLOCK)));
+    rule_profile_phase_begin("MEMORY");
     val_memory_create_info_table(MemoryInfoTable);
+    rule_profile_phase_end();
 }
 
 void
@@ -161,7 +184,9 @@ createDmaInfoTable(
 
     DmaInfoTable = val_aligned_alloc(SIZE_4K, sizeof(DMA_INFO_TABLE)
                     + (PLATFORM_OVERRIDE_DMA_CNT * sizeof(DMA_INFO_BLOCK)));
+    rule_profile_phase_begin("DMA");
     val_dma_create_info_table(DmaInfoTable);
+    rule_profile_phase_end();
 }
 
 void
@@ -172,13 +197,16 @@ createPmuInfoTable(
 
     PmuInfoTable = val_aligned_alloc(SIZE_4K, sizeof(PMU_INFO_TABLE)
                     + PLATFORM_OVERRIDE_PMU_NODE_CNT * sizeof(PMU_INFO_BLOCK));
+    rule_profile_phase_begin("PMU");
     val_pmu_create_info_table(PmuInfoTable);
+    rule_profile_phase_end();
 }
 
 uint32_t
 createRasInfoTable(
 )
 {
+    uint32_t   Status;
     uint64_t   *RasInfoTable;
 
     RasInfoTable = val_aligned_alloc(SIZE_4K, sizeof(RAS_INFO_TABLE)
@@ -186,7 +214,11 @@ createRasInfoTable(
                     * sizeof(RAS_NODE_INFO) + PLATFORM_OVERRIDE_NUM_RAS_NODES
                     * sizeof(RAS_INTERFACE_INFO)
                     + PLATFORM_OVERRIDE_NUM_RAS_NODES * sizeof(RAS_INTERRUPT_INFO));
-    return val_ras_create_info_table(RasInfoTable);
+    rule_profile_phase_begin("RAS");
+    Status = val_ras_create_info_table(RasInfoTable);
+    rule_profile_phase_end();
+
+    return Status;
 }
 
 void
@@ -197,7 +229,9 @@ createCacheInfoTable(
 
     CacheInfoTable = val_aligned_alloc(SIZE_4K, sizeof(CACHE_INFO_TABLE)
                     + PLATFORM_OVERRIDE_CACHE_CNT * sizeof(CACHE_INFO_ENTRY));
+    rule_profile_phase_begin("CACHE");
     val_cache_create_info_table(CacheInfoTable);
+    rule_profile_phase_end();
 }
 
 void
@@ -209,7 +243,9 @@ createMpamInfoTable(
     MpamInfoTable = val_aligned_alloc(SIZE_4K, sizeof(MPAM_INFO_TABLE)
                                         + PLATFORM_MPAM_MSC_COUNT * sizeof(MPAM_MSC_NODE)
                                         + PLATFORM_MPAM_MSC_COUNT * sizeof(MPAM_RESOURCE_NODE));
+    rule_profile_phase_begin("MPAM");
     val_mpam_create_info_table(MpamInfoTable);
+    rule_profile_phase_end();
 }
 
 void
@@ -221,7 +257,9 @@ createHmatInfoTable(
     HmatInfoTable = val_aligned_alloc(SIZE_4K, sizeof(HMAT_INFO_TABLE)
                                         + PLATFORM_OVERRIDE_HMAT_MEM_ENTRIES
                                           * sizeof(HMAT_BW_ENTRY));
+    rule_profile_phase_begin("HMAT");
     val_hmat_create_info_table(HmatInfoTable);
+    rule_profile_phase_end();
 }
 
 void
@@ -235,7 +273,9 @@ createSratInfoTable(
                                         + PLATFORM_OVERRIDE_MEM_AFF_CNT * sizeof(SRAT_MEM_AFF_ENTRY)
                                         + PLATFORM_OVERRIDE_GICC_AFF_CNT
                                           * sizeof(SRAT_GICC_AFF_ENTRY));
+    rule_profile_phase_begin("SRAT");
     val_srat_create_info_table(SratInfoTable);
+    rule_profile_phase_end();
 }
 
 void
@@ -246,7 +286,9 @@ createPccInfoTable(
 
     PccInfoTable = val_aligned_alloc(SIZE_4K,
                                         PLATFORM_PCC_SUBSPACE_COUNT * sizeof(PCC_INFO));
+    rule_profile_phase_begin("PCC");
     val_pcc_create_info_table(PccInfoTable);
+    rule_profile_phase_end();
 }
 
 /**
@@ -274,8 +316,9 @@ createInfoTable(
 
     InfoTable = val_aligned_alloc(SIZE_4K, info_table_size);
 
-
+    rule_profile_phase_begin(table_name);
     (*create_info_tbl_func)(InfoTable);
+    rule_profile_phase_end();
 }
 
 void
@@ -295,5 +338,7 @@ createTpm2InfoTable(
   uint64_t *Tpm2InfoTable;
 
   Tpm2InfoTable = val_aligned_alloc(SIZE_4K, sizeof(TPM2_INFO_TABLE));
+  rule_profile_phase_begin("TPM2");
   val_tpm2_create_info_table(Tpm2InfoTable);
+  rule_profile_phase_end();
 }
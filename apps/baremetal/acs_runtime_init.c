@@ -35,52 +35,97 @@ const uint32_t acs_build_module_count =
     sizeof(acs_build_module_array) / sizeof(acs_build_module_array[0]);
 #endif
 
-static bool
-acs_list_contains(const uint32_t *list, uint32_t count, uint32_t value)
+/*
+ * Module membership masks derived from the run request. acs_is_module_enabled()
+ * is called once per info table/module on every boot, so the rule list is
+ * scanned once per request instead of once per query.
+ */
+typedef struct {
+  const acs_run_request_t *ctx;
+  const RULE_ID_e *rule_list;
+  uint32_t rule_count;
+  const uint32_t *skip_modules;
+  uint32_t num_skip_modules;
+  const uint32_t *execute_modules;
+  uint32_t num_modules;
+  uint64_t skip_mask;     /* modules in -skipmodule */
+  uint64_t enabled_mask;  /* modules in -m or owning a selected rule */
+} acs_module_mask_cache_t;
+
+static acs_module_mask_cache_t g_module_mask_cache;
+
+/* Every module needs its own bit in the 64-bit masks above */
+_Static_assert(MODULE_ID_SENTINEL <= 64, "module masks hold at most 64 modules");
+
+static uint64_t
+acs_module_bit(uint32_t module)
 {
+  return (module < MODULE_ID_SENTINEL) ? (1ull << module) : 0ull;
+}
+
+static void
+acs_module_mask_refresh(const acs_run_request_t *ctx)
+{
+  acs_module_mask_cache_t *cache = &g_module_mask_cache;
   uint32_t i;
+  RULE_ID_e rule;
+
+  /* Rebuild only when the run request selections have changed */
+  if (cache->ctx == ctx &&
+      cache->rule_list == ctx->rule_list && cache->rule_count == ctx->rule_count &&
+      cache->skip_modules == ctx->skip_modules &&
+      cache->num_skip_modules == ctx->num_skip_modules &&
+      cache->execute_modules == ctx->execute_modules &&
+      cache->num_modules == ctx->num_modules)
+      return;
 
-  if (list == NULL || count == 0)
-      return false;
+  cache->ctx = ctx;
+  cache->rule_list = ctx->rule_list;
+  cache->rule_count = ctx->rule_count;
+  cache->skip_modules = ctx->skip_modules;
+  cache->num_skip_modules = ctx->num_skip_modules;
+  cache->execute_modules = ctx->execute_modules;
+  cache->num_modules = ctx->num_modules;
+  cache->skip_mask = 0;
+  cache->enabled_mask = 0;
+
+  if (ctx->skip_modules != NULL) {
+      for (i = 0; i < ctx->num_skip_modules; i++)
+          cache->skip_mask |= acs_module_bit(ctx->skip_modules[i]);
+  }
 
-  for (i = 0; i < count; i++) {
-      if (list[i] == value)
-          return true;
+  if (ctx->execute_modules != NULL) {
+      for (i = 0; i < ctx->num_modules; i++)
+          cache->enabled_mask |= acs_module_bit(ctx->execute_modules[i]);
   }
 
-  return false;
+  if (ctx->rule_list != NULL) {
+      for (i = 0; i < ctx->rule_count; i++) {
+          rule = ctx->rule_list[i];
+
+          if (rule < 0 || rule >= RULE_ID_SENTINEL)
+              continue;
+
+          cache->enabled_mask |= acs_module_bit(rule_test_map[rule].module_id);
+      }
+  }
 }
 
 bool
 acs_is_module_enabled(uint32_t module_base)
 {
     const acs_run_request_t *ctx = acs_get_run_request();
-    RULE_ID_e rule;
+
+    acs_module_mask_refresh(ctx);
+
     /* Runtime / EL3 / CLI override has highest priority */
-    if (ctx->num_skip_modules)
-      if (acs_list_contains(ctx->skip_modules, ctx->num_skip_modules, module_base))
-        return false;
+    if (g_module_mask_cache.skip_mask & acs_module_bit(module_base))
+      return false;
 
     if (ctx->rule_count == 0 && ctx->num_modules == 0)
       return true;  /* No overrides: enable everything */
 
-    if (ctx->num_modules) {
-        if (acs_list_contains(ctx->execute_modules, ctx->num_modules, module_base))
-          return true;
-    }
-
-    for (uint32_t i = 0; i < ctx->rule_count; i++)
-    {
-      rule = ctx->rule_list[i];
-
-      if (rule < 0 || rule >= RULE_ID_SENTINEL)
-        continue;
-
-      if (rule_test_map[rule].module_id == module_base)
-        return true;
-    }
-
-    return false;
+    return (g_module_mask_cache.enabled_mask & acs_module_bit(module_base)) != 0;
 }
 
 void
@@ -112,6 +157,8 @@ acs_load_execution_policy_defaults(acs_execution_policy_t *policy)
       policy->crypto_support = defaults->crypto_support;
       policy->sys_last_lvl_cache = defaults->sys_last_lvl_cache;
       policy->el1skiptrap_mask = defaults->el1skiptrap_mask;
+      policy->profile_format = defaults->profile_format;
+      policy->deferred_log = defaults->deferred_log;
   }
 
   platform_defaults = acs_get_platform_execution_policy_defaults();
@@ -125,6 +172,8 @@ acs_load_execution_policy_defaults(acs_execution_policy_t *policy)
   policy->crypto_support = platform_defaults->crypto_support;
   policy->sys_last_lvl_cache = platform_defaults->sys_last_lvl_cache;
   policy->el1skiptrap_mask = platform_defaults->el1skiptrap_mask;
+  policy->profile_format = platform_defaults->profile_format;
+  policy->deferred_log = platform_defaults->deferred_log;
 
   if (platform_defaults->timeout_pass != 0u)
       policy->timeout_pass = platform_defaults->timeout_pass;
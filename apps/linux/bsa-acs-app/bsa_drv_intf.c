@@ -23,6 +23,7 @@
 #include <sys/ioctl.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <time.h>
 #include "bsa_drv_intf.h"
 
 typedef
@@ -65,16 +66,33 @@ call_drv_get_status(unsigned long int *arg0, unsigned long int *arg1, unsigned l
   return test_params.api_num;
 }
 
+/* Status polls before the wait starts sleeping, and the longest sleep
+   between polls once it does */
+#define DRV_POLL_SPIN_COUNT    64
+#define DRV_POLL_SLEEP_MAX_NS  1000000L
+
 int
 call_drv_wait_for_completion()
 {
   unsigned long int arg0, arg1, arg2;
+  unsigned int polls = 0;
+  struct timespec delay = {0, 1000};
 
   arg0 = DRV_STATUS_PENDING;
 
   while (arg0 == DRV_STATUS_PENDING){
     call_drv_get_status(&arg0, &arg1, &arg2);
     read_from_proc_bsa_msg();
+    if (arg0 != DRV_STATUS_PENDING)
+      break;
+
+    /* The driver has no completion event: back off rather than spin */
+    if (++polls > DRV_POLL_SPIN_COUNT) {
+      nanosleep(&delay, NULL);
+      delay.tv_nsec *= 2;
+      if (delay.tv_nsec > DRV_POLL_SLEEP_MAX_NS)
+        delay.tv_nsec = DRV_POLL_SLEEP_MAX_NS;
+    }
   }
 
   return arg1;
@@ -0,0 +1,26 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+#ifndef __LITMUS_LINUX_ASM_GENERIC_ATOMIC_H__
+#define __LITMUS_LINUX_ASM_GENERIC_ATOMIC_H__
+
+#define atomic_inc_fetch(ptr)       __sync_add_and_fetch(ptr, 1)
+#define atomic_dec_fetch(ptr)       __sync_sub_and_fetch(ptr, 1)
+#define atomic_add_fetch(ptr, val)  __sync_add_and_fetch(ptr, val)
+#define atomic_sub_fetch(ptr, val)  __sync_sub_and_fetch(ptr, val)
+
+#endif /* __LITMUS_LINUX_ASM_GENERIC_ATOMIC_H__ */
@@ -0,0 +1,48 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+/*
+ * Userspace cannot reach the page tables. The litmus tests used here only
+ * save a variable's PTE and write it back after each run, so every page is
+ * given a shadow entry instead and TLB maintenance is a no-op.
+ */
+
+#ifndef __LITMUS_LINUX_ASM_MMU_H__
+#define __LITMUS_LINUX_ASM_MMU_H__
+
+#include <asm/pgtable-hwdef.h>
+
+typedef struct {
+  pteval_t pgd;
+} pgd_t;
+
+extern pgd_t *mmu_idmap;
+
+pteval_t *mmu_get_pte(pgd_t *pgtable, uintptr_t vaddr);
+
+static inline void flush_tlb_page(unsigned long vaddr)
+{
+  (void)vaddr;
+  asm volatile("" ::: "memory");
+}
+
+static inline void flush_tlb_all(void)
+{
+  asm volatile("" ::: "memory");
+}
+
+#endif /* __LITMUS_LINUX_ASM_MMU_H__ */
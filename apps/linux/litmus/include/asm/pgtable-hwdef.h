@@ -0,0 +1,35 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+#ifndef __LITMUS_LINUX_ASM_PGTABLE_HWDEF_H__
+#define __LITMUS_LINUX_ASM_PGTABLE_HWDEF_H__
+
+#include <libcflat.h>
+
+#define PAGE_SHIFT          12
+#define PAGE_SIZE           (1UL << PAGE_SHIFT)
+
+typedef u64 pteval_t;
+
+/* MAIR attribute indices, as laid out by kvm-unit-tests */
+#define MT_DEVICE_nGnRnE    0
+#define MT_DEVICE_nGnRE     1
+#define MT_DEVICE_GRE       2
+#define MT_NORMAL_NC        3
+#define MT_NORMAL           4
+
+#endif /* __LITMUS_LINUX_ASM_PGTABLE_HWDEF_H__ */
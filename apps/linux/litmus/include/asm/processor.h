@@ -0,0 +1,103 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+/*
+ * Exception and per-CPU state for the Linux litmus runtime.
+ *
+ * A "CPU" is one of the pinned test threads started by on_cpus(). Exception
+ * handlers installed for the current thread are called from the SIGSEGV,
+ * SIGBUS and SIGILL handlers in litmus_linux.c with the interrupted
+ * registers, so the litmus fault handlers can redirect the PC as on EL1.
+ */
+
+#ifndef __LITMUS_LINUX_ASM_PROCESSOR_H__
+#define __LITMUS_LINUX_ASM_PROCESSOR_H__
+
+#include <libcflat.h>
+
+enum vector {
+  EL1T_SYNC,
+  EL1T_IRQ,
+  EL1T_FIQ,
+  EL1T_ERROR,
+  EL1H_SYNC,
+  EL1H_IRQ,
+  EL1H_FIQ,
+  EL1H_ERROR,
+  EL0_SYNC_64,
+  EL0_IRQ_64,
+  EL0_FIQ_64,
+  EL0_ERROR_64,
+  EL0_SYNC_32,
+  EL0_IRQ_32,
+  EL0_FIQ_32,
+  EL0_ERROR_32,
+  VECTOR_MAX,
+};
+
+#define EC_MAX                  64
+#define ESR_EL1_EC_SHIFT        26
+#define ESR_EL1_EC_UNKNOWN      0x00
+#define ESR_EL1_EC_DABT_EL0     0x24
+#define ESR_EL1_EC_DABT_EL1     0x25
+
+struct pt_regs {
+  u64 regs[31];
+  u64 sp;
+  u64 pc;
+  u64 pstate;
+};
+
+typedef void (*exception_fn)(struct pt_regs *regs, unsigned int esr);
+
+struct thread_info {
+  int cpu;
+  unsigned int flags;
+  exception_fn exception_handlers[VECTOR_MAX][EC_MAX];
+};
+
+struct thread_info *current_thread_info(void);
+void install_exception_handler(enum vector v, unsigned int ec, exception_fn fn);
+
+/*
+ * EL0 cannot read CNTPCT_EL0 unless the kernel allows it, so the physical
+ * counter reads used for timing go to the virtual counter instead.
+ */
+static inline u64 litmus_read_cntpct_el0(void)
+{
+  u64 val;
+
+  asm volatile("isb\n\tmrs %0, cntvct_el0" : "=r" (val) :: "memory");
+  return val;
+}
+
+static inline u64 litmus_read_cntfrq_el0(void)
+{
+  u64 val;
+
+  asm volatile("mrs %0, cntfrq_el0" : "=r" (val));
+  return val;
+}
+
+#define read_sysreg(r) litmus_read_##r()
+
+static inline u64 get_cntfrq(void)
+{
+  return read_sysreg(cntfrq_el0);
+}
+
+#endif /* __LITMUS_LINUX_ASM_PROCESSOR_H__ */
@@ -0,0 +1,34 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+#ifndef __LITMUS_LINUX_ASM_SMP_H__
+#define __LITMUS_LINUX_ASM_SMP_H__
+
+#include <asm/processor.h>
+
+#define smp_processor_id() (current_thread_info()->cpu)
+
+/*
+ * Run func(data) on nr_threads threads, thread n pinned to the n-th CPU of
+ * the list given to litmus_linux_init(), and wait for all of them.
+ */
+void litmus_on_cpus(void (*func)(void *data), void *data, int nr_threads);
+
+/* Each litmus test starts exactly AVAIL threads, its own topology size */
+#define on_cpus(func, data) litmus_on_cpus((func), (data), AVAIL)
+
+#endif /* __LITMUS_LINUX_ASM_SMP_H__ */
@@ -0,0 +1,67 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+/*
+ * Linux userspace stand-in for the kvm-unit-tests libcflat.h used by the
+ * litmus tests in mem_test/litmus-tests.
+ *
+ * Like the original, this declares its own C library subset instead of
+ * including <stdio.h> and <string.h>: litmus utils.h defines FILE, stdout
+ * and stderr itself in KVM mode, and utils.c defines errno and strerror.
+ */
+
+#ifndef __LITMUS_LINUX_LIBCFLAT_H__
+#define __LITMUS_LINUX_LIBCFLAT_H__
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+typedef uint8_t   u8;
+typedef int8_t    s8;
+typedef uint16_t  u16;
+typedef int16_t   s16;
+typedef uint32_t  u32;
+typedef int32_t   s32;
+typedef uint64_t  u64;
+typedef int64_t   s64;
+
+#define xstr(s...) xxstr(s)
+#define xxstr(s...) #s
+
+int printf(const char *fmt, ...);
+int snprintf(char *buf, size_t size, const char *fmt, ...);
+
+/* libcflat puts() does not append a newline; the litmus reports rely on it */
+int litmus_puts(const char *s);
+#define puts(s) litmus_puts(s)
+
+void exit(int code) __attribute__((noreturn));
+void abort(void) __attribute__((noreturn));
+void *malloc(size_t size);
+void free(void *ptr);
+long strtol(const char *nptr, char **endptr, int base);
+
+int strcmp(const char *s1, const char *s2);
+size_t strlen(const char *s);
+void *memcpy(void *dst, const void *src, size_t n);
+void *memset(void *s, int c, size_t n);
+int memcmp(const void *s1, const void *s2, size_t n);
+
+#endif /* __LITMUS_LINUX_LIBCFLAT_H__ */
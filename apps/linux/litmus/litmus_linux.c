@@ -0,0 +1,327 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+/*
+ * Linux userspace runtime for the litmus tests in mem_test/litmus-tests.
+ *
+ * This supplies the kvm-unit-tests services the tests are generated against
+ * (on_cpus, per-CPU exception handlers, page table lookup) on top of pinned
+ * pthreads and POSIX signals, so the test sources build unmodified.
+ */
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+
+#include <asm/processor.h>
+#include <asm/smp.h>
+#include <asm/mmu.h>
+
+#include "litmus_linux.h"
+
+/* AArch64 system instruction class: MSR, MRS, SYS and SYSL */
+#define LITMUS_SYS_INSN_MASK   0xffc00000u
+#define LITMUS_SYS_INSN        0xd5000000u
+
+#define LITMUS_SHADOW_BUCKETS  1024
+
+/* Passed to exceptions_init_test(); the VBAR_EL1 write itself is skipped */
+uint32_t vector_table;
+
+pgd_t *mmu_idmap;
+
+/* Shadow page table entries, one per page, hashed by page address */
+typedef struct LITMUS_SHADOW_PTE {
+  struct LITMUS_SHADOW_PTE *next;
+  uintptr_t page;
+  pteval_t pte;
+} LITMUS_SHADOW_PTE_t;
+
+static LITMUS_SHADOW_PTE_t *litmus_shadow_pte[LITMUS_SHADOW_BUCKETS];
+static pthread_mutex_t litmus_shadow_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int litmus_cpus[LITMUS_MAX_CPUS];
+static int litmus_nr_cpus;
+
+static __thread struct thread_info litmus_thread_info;
+
+typedef struct {
+  pthread_t thread;
+  int cpu;
+  void (*func)(void *data);
+  void *data;
+} LITMUS_THREAD_t;
+
+int litmus_puts(const char *s)
+{
+  return fputs(s, stdout);
+}
+
+/**
+  @brief   Return the shadow page table entry of a test variable.
+           Entries start out valid, which is all the tests check before
+           restoring the value they saved at init time.
+
+  @param   pgtable  Unused, there is no page table to walk.
+  @param   vaddr    Address of the test variable.
+
+  @return  Pointer to the shadow entry of the page holding vaddr. Each
+           page has its own entry, as with a real page table.
+**/
+pteval_t *mmu_get_pte(pgd_t *pgtable, uintptr_t vaddr)
+{
+  uintptr_t page = vaddr & ~(uintptr_t)(PAGE_SIZE - 1);
+  LITMUS_SHADOW_PTE_t **bucket;
+  LITMUS_SHADOW_PTE_t *entry;
+
+  (void)pgtable;
+  bucket = &litmus_shadow_pte[(page >> PAGE_SHIFT) % LITMUS_SHADOW_BUCKETS];
+
+  pthread_mutex_lock(&litmus_shadow_lock);
+  for (entry = *bucket; entry != NULL; entry = entry->next) {
+    if (entry->page == page)
+      break;
+  }
+  if (entry == NULL) {
+    entry = malloc(sizeof(*entry));
+    if (entry == NULL) {
+      perror("malloc");
+      exit(1);
+    }
+    entry->page = page;
+    entry->pte = page | 0x1;
+    entry->next = *bucket;
+    *bucket = entry;
+  }
+  pthread_mutex_unlock(&litmus_shadow_lock);
+
+  return &entry->pte;
+}
+
+struct thread_info *current_thread_info(void)
+{
+  return &litmus_thread_info;
+}
+
+void install_exception_handler(enum vector v, unsigned int ec, exception_fn fn)
+{
+  if (v < VECTOR_MAX && ec < EC_MAX)
+    litmus_thread_info.exception_handlers[v][ec] = fn;
+}
+
+/**
+  @brief   Forward a synchronous fault taken by a test thread to the
+           exception handler it installed for EL1H_SYNC, as the EL1 vectors
+           do under kvm-unit-tests. EL1-only system instructions, such as the
+           VBAR_EL1 write in exceptions_init_test(), are stepped over.
+
+  @param   sig   Signal number.
+  @param   info  Signal information, unused.
+  @param   ctx   Interrupted user context.
+
+  @return  None
+**/
+static void litmus_fault_signal(int sig, siginfo_t *info, void *ctx)
+{
+  ucontext_t *uc = ctx;
+  mcontext_t *mc = &uc->uc_mcontext;
+  struct pt_regs regs;
+  exception_fn handler;
+  unsigned int ec;
+
+  (void)info;
+
+  if (sig == SIGILL) {
+    if ((*(uint32_t *)mc->pc & LITMUS_SYS_INSN_MASK) == LITMUS_SYS_INSN) {
+      mc->pc += 4;
+      return;
+    }
+    ec = ESR_EL1_EC_UNKNOWN;
+  } else {
+    ec = ESR_EL1_EC_DABT_EL1;
+  }
+
+  handler = litmus_thread_info.exception_handlers[EL1H_SYNC][ec];
+  if (handler == NULL) {
+    /* Not a fault the test expects, let it take the default action */
+    signal(sig, SIG_DFL);
+    return;
+  }
+
+  memcpy(regs.regs, mc->regs, sizeof(regs.regs));
+  regs.sp = mc->sp;
+  regs.pc = mc->pc;
+  regs.pstate = mc->pstate;
+
+  handler(&regs, ec << ESR_EL1_EC_SHIFT);
+
+  memcpy(mc->regs, regs.regs, sizeof(regs.regs));
+  mc->sp = regs.sp;
+  mc->pc = regs.pc;
+  mc->pstate = regs.pstate;
+}
+
+/**
+  @brief   Parse a CPU list such as "0-3,8" into litmus_cpus.
+
+  @param   list  CPU list string.
+
+  @return  Number of CPUs parsed, or -1 if the list is malformed.
+**/
+static int litmus_parse_cpus(const char *list)
+{
+  const char *p = list;
+  char *end;
+  long first, last, cpu;
+  int count = 0;
+
+  while (*p) {
+    first = strtol(p, &end, 10);
+    if (end == p || first < 0)
+      return -1;
+    last = first;
+    p = end;
+    if (*p == '-') {
+      p++;
+      last = strtol(p, &end, 10);
+      if (end == p || last < first)
+        return -1;
+      p = end;
+    }
+    for (cpu = first; cpu <= last; cpu++) {
+      if (count == LITMUS_MAX_CPUS || cpu >= CPU_SETSIZE)
+        return -1;
+      litmus_cpus[count++] = (int)cpu;
+    }
+    if (*p == ',')
+      p++;
+    else if (*p)
+      return -1;
+  }
+
+  return count;
+}
+
+/**
+  @brief   Set up the runtime: the CPUs test threads are pinned to and the
+           fault signal handlers.
+
+  @param   cpu_list  CPU list such as "0-3,8", or NULL for every CPU the
+                     process may run on.
+
+  @return  Number of CPUs in use, or -1 on error.
+**/
+int litmus_linux_init(const char *cpu_list)
+{
+  struct sigaction sa;
+  cpu_set_t set;
+  int cpu;
+
+  if (cpu_list) {
+    litmus_nr_cpus = litmus_parse_cpus(cpu_list);
+    if (litmus_nr_cpus <= 0) {
+      fprintf(stderr, "Invalid CPU list '%s'\n", cpu_list);
+      return -1;
+    }
+  } else {
+    if (sched_getaffinity(0, sizeof(set), &set)) {
+      perror("sched_getaffinity");
+      return -1;
+    }
+    litmus_nr_cpus = 0;
+    for (cpu = 0; cpu < CPU_SETSIZE && litmus_nr_cpus < LITMUS_MAX_CPUS; cpu++)
+      if (CPU_ISSET(cpu, &set))
+        litmus_cpus[litmus_nr_cpus++] = cpu;
+  }
+
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_sigaction = litmus_fault_signal;
+  sa.sa_flags = SA_SIGINFO;
+  sigemptyset(&sa.sa_mask);
+  if (sigaction(SIGSEGV, &sa, NULL) || sigaction(SIGBUS, &sa, NULL) ||
+      sigaction(SIGILL, &sa, NULL)) {
+    perror("sigaction");
+    return -1;
+  }
+
+  return litmus_nr_cpus;
+}
+
+int litmus_get_cpus(const int **cpus)
+{
+  *cpus = litmus_cpus;
+  return litmus_nr_cpus;
+}
+
+static void *litmus_thread_start(void *arg)
+{
+  LITMUS_THREAD_t *t = arg;
+
+  litmus_thread_info.cpu = t->cpu;
+  t->func(t->data);
+
+  return NULL;
+}
+
+void litmus_on_cpus(void (*func)(void *data), void *data, int nr_threads)
+{
+  static int warned;
+  LITMUS_THREAD_t *threads;
+  pthread_attr_t attr;
+  cpu_set_t set;
+  int i, ret;
+
+  if (nr_threads > litmus_nr_cpus && !warned) {
+    fprintf(stderr, "Warning: %d test threads share %d CPUs, "
+            "results will be weaker\n", nr_threads, litmus_nr_cpus);
+    warned = 1;
+  }
+
+  threads = calloc(nr_threads, sizeof(*threads));
+  if (threads == NULL) {
+    perror("calloc");
+    exit(1);
+  }
+
+  for (i = 0; i < nr_threads; i++) {
+    threads[i].cpu = i;
+    threads[i].func = func;
+    threads[i].data = data;
+
+    pthread_attr_init(&attr);
+    CPU_ZERO(&set);
+    CPU_SET(litmus_cpus[i % litmus_nr_cpus], &set);
+    pthread_attr_setaffinity_np(&attr, sizeof(set), &set);
+    ret = pthread_create(&threads[i].thread, &attr, litmus_thread_start,
+                         &threads[i]);
+    pthread_attr_destroy(&attr);
+    if (ret) {
+      fprintf(stderr, "pthread_create: %s\n", strerror(ret));
+      exit(1);
+    }
+  }
+
+  for (i = 0; i < nr_threads; i++)
+    pthread_join(threads[i].thread, NULL);
+
+  free(threads);
+}
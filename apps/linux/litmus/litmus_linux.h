@@ -0,0 +1,27 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+#ifndef __LITMUS_LINUX_H__
+#define __LITMUS_LINUX_H__
+
+/* Upper bound on the CPU list given to the litmus runner */
+#define LITMUS_MAX_CPUS  1024
+
+int litmus_linux_init(const char *cpu_list);
+int litmus_get_cpus(const int **cpus);
+
+#endif /* __LITMUS_LINUX_H__ */
@@ -0,0 +1,170 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bsa_acs_litmus.h"
+#include "litmus_linux.h"
+
+typedef struct {
+  const char *name;
+  int (*entry)(int argc, char **argv);
+} LITMUS_TEST_t;
+
+static const LITMUS_TEST_t litmus_tests[] = {
+  {"2+2W+dmb.sys",                   _X2_2B_2W_2B_dmb_2E_sys},
+  {"CO-MIXED-20cc+H",                CO_2D_MIXED_2D_20cc_2B_H},
+  {"CoRR",                           CoRR},
+  {"CoRW1",                          CoRW1},
+  {"CoRW2+posb1b0+h0",               CoRW2_2B_posb1b0_2B_h0},
+  {"CoRW2",                          CoRW2},
+  {"CoWR",                           CoWR},
+  {"CoWW",                           CoWW},
+  {"LB+BEQ4",                        LB_2B_BEQ4},
+  {"LB+CSEL-addr-po+DMB",            LB_2B_CSEL_2D_addr_2D_po_2B_DMB},
+  {"LB+CSEL-rfi-data+DMB",           LB_2B_CSEL_2D_rfi_2D_data_2B_DMB},
+  {"LB+dmb.sy+data-wsi-wsi+MIXED+H", LB_2B_dmb_2E_sy_2B_data_2D_wsi_2D_wsi_2B_MIXED_2B_H},
+  {"LB+dmb.sys",                     LB_2B_dmb_2E_sys},
+  {"LB+rel+BEQ2",                    LB_2B_rel_2B_BEQ2},
+  {"LB+rel+CSEL-CSEL",               LB_2B_rel_2B_CSEL_2D_CSEL},
+  {"LB+rel+data",                    LB_2B_rel_2B_data},
+  {"MP+dmb.sys",                     MP_2B_dmb_2E_sys},
+  {"MP-Koeln",                       MP_2D_Koeln},
+  {"R+dmb.sys",                      R_2B_dmb_2E_sys},
+  {"S+dmb.sys",                      S_2B_dmb_2E_sys},
+  {"S+rel+CSEL-data",                S_2B_rel_2B_CSEL_2D_data},
+  {"S+rel+CSEL-rf-reg",              S_2B_rel_2B_CSEL_2D_rf_2D_reg},
+  {"SB+dmb.sys",                     SB_2B_dmb_2E_sys},
+  {"T10B",                           T10B},
+  {"T10C",                           T10C},
+  {"T15-corrected",                  T15_2D_corrected},
+  {"T15-datadep-corrected",          T15_2D_datadep_2D_corrected},
+  {"T3-bis",                         T3_2D_bis},
+  {"T3",                             T3},
+  {"T7",                             T7},
+  {"T7dep",                          T7dep},
+  {"T8+BIS",                         T8_2B_BIS},
+  {"T9B",                            T9B},
+};
+
+#define LITMUS_NUM_TESTS (sizeof(litmus_tests) / sizeof(litmus_tests[0]))
+
+static void usage(const char *prog)
+{
+  printf("Usage: %s [-c <cpus>] [-l] [-h] [<test>...] [-- <litmus options>]\n"
+         "  -c <cpus>  Pin test threads to these CPUs, e.g. 0-3,8\n"
+         "             (default: every CPU the process may run on)\n"
+         "  -l         List the tests\n"
+         "  -h         Show this help\n"
+         "  <test>     Run only the named tests (default: all)\n"
+         "Options after -- are passed to every test, e.g. -- -s 10k -r 100\n",
+         prog);
+}
+
+static int find_test(const char *name)
+{
+  unsigned int i;
+
+  for (i = 0; i < LITMUS_NUM_TESTS; i++)
+    if (strcmp(litmus_tests[i].name, name) == 0)
+      return i;
+
+  return -1;
+}
+
+int main(int argc, char **argv)
+{
+  const char *cpu_list = NULL;
+  const int *cpus;
+  char **test_argv;
+  int *selected;
+  int nr_selected = 0;
+  int nr_opts = 0;
+  int nr_cpus, i, t;
+
+  selected = calloc(LITMUS_NUM_TESTS, sizeof(*selected));
+  if (selected == NULL) {
+    perror("calloc");
+    return 1;
+  }
+
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--") == 0) {
+      nr_opts = argc - i - 1;
+      break;
+    } else if (strcmp(argv[i], "-c") == 0) {
+      if (++i == argc) {
+        usage(argv[0]);
+        return 1;
+      }
+      cpu_list = argv[i];
+    } else if (strcmp(argv[i], "-l") == 0) {
+      for (t = 0; t < (int)LITMUS_NUM_TESTS; t++)
+        printf("%s\n", litmus_tests[t].name);
+      return 0;
+    } else if (strcmp(argv[i], "-h") == 0) {
+      usage(argv[0]);
+      return 0;
+    } else {
+      t = find_test(argv[i]);
+      if (t < 0) {
+        fprintf(stderr, "Unknown test '%s', use -l to list the tests\n", argv[i]);
+        return 1;
+      }
+      if (!selected[t]) {
+        selected[t] = 1;
+        nr_selected++;
+      }
+    }
+  }
+
+  nr_cpus = litmus_linux_init(cpu_list);
+  if (nr_cpus < 0)
+    return 1;
+
+  /* Each test parses its options from argv[1], argv[0] carries its name */
+  test_argv = calloc(nr_opts + 2, sizeof(*test_argv));
+  if (test_argv == NULL) {
+    perror("calloc");
+    return 1;
+  }
+  memcpy(&test_argv[1], &argv[argc - nr_opts], nr_opts * sizeof(*test_argv));
+
+  litmus_get_cpus(&cpus);
+  printf("\nRunning tests on %d CPUs:", nr_cpus);
+  for (i = 0; i < nr_cpus; i++)
+    printf(" %d", cpus[i]);
+  printf("\n\n");
+
+  for (t = 0; t < (int)LITMUS_NUM_TESTS; t++) {
+    if (nr_selected && !selected[t])
+      continue;
+    test_argv[0] = (char *)litmus_tests[t].name;
+    printf("\n*********************************************\n");
+    fflush(stdout);
+    litmus_tests[t].entry(nr_opts + 1, test_argv);
+    fflush(stdout);
+  }
+
+  printf("\n\n      *** Memory model consistency tests run complete. ***\n");
+
+  free(test_argv);
+  free(selected);
+  return 0;
+}
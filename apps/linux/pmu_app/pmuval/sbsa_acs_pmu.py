@@ -45,12 +45,11 @@ parser.add_argument("-e", "--event", type=ecode, action="append", default=[], he
 parser.add_argument("-r", "--repeat", type=int, default=1, help="repeat test N times")
 parser.add_argument("-v", "--verbose", action="count", default=0, help="increase verbosity level")
 parser.add_argument("--scaling", type=int, default=0, help="Enable scaling factor")
+parser.add_argument("--batch", type=int, default=6, help="measure up to N rules together against one workload run (1: one at a time)")
 parser.add_argument("command", nargs=argparse.REMAINDER, help="command to execute")
 
 opts = parser.parse_args([])
 
-total = [0, 0, 0]
-
 class BadEvent(Exception):
     pass
 
@@ -83,6 +82,7 @@ class Relation(EventProperty):
         self.sup = None       # The event code.
         self.reason = None    # Event description
         self.rule = None      # SBSA rule ID assosiated with event
+        self.counts = [0, 0, 0]  # Event count for each scaling step
 
     def contains(self, e):
         return e == self.sup
@@ -162,80 +162,63 @@ def open_event(en, group=None, enabled=True):
 
 class Monitor:
     """
-    Set up the events to monitor a relationship.
+    Set up the events to monitor a batch of relationships during one workload run.
+
+    Each event is opened on its own rather than in a group, so a batch that
+    needs more counters than are free is multiplexed by the kernel instead
+    of failing to open. Multiplexed readings are reported as incomplete.
     """
-    def __init__(self, r, x):
-        self.r = r
+    def __init__(self, rels, x):
+        self.rels = rels
         self.x = x
-        self.supe = open_event(r.sup, enabled=False)
+        self.events = []
+        try:
+            for r in rels:
+                self.events.append(open_event(r.sup, enabled=False))
+        except Exception:
+            self.close()
+            raise
 
     def enable(self):
-        self.supe.enable()   # Enable the group
+        for e in self.events:
+            e.enable()
         return self
 
     def read(self):
-        return Witness(self)
+        return [e.read() for e in self.events]
 
     def disable(self):
-        self.supe.disable()  # Disable the group
+        for e in self.events:
+            e.disable()
         return self
 
     def close(self):
-        self.supe.close()
-        return self
-
-def read_events_values(el):
-    """
-    Read a set of values from a list of events. The first event may be a
-    group event, and some or all of the remaining events may be members of its group.
-    These may be followed by non-group events.
-    """
-    e = el[0]
-    if PerfEventAttr(e.attr_struct()).read_format & PERF_FORMAT_GROUP:
-        g = e.read()   # a GroupReading object
-        values = [r.value for r in g]
-    else:
-        values = []
-    ix = len(values)
-    values += [e.read().value for e in el[ix:]]
-    return values
-
-class Witness:
-    """
-    Take a reading from a monitor, to get a set of event values to check against the relationship.
-    """
-    def __init__(self, m):
-        self.m = m
-        self.read()
-    def read(self):
-        vs = read_events_values([self.m.supe])
-        self.sup_value = vs[0]
-        total[self.m.x] = self.sup_value
-        self.ok = self.accepts()
+        for e in self.events:
+            e.close()
+        self.events = []
         return self
 
-    def accepts(self):
-        if opts.scaling:
-            if x == 2:
-                return self.m.r.accepts(total)
-            else :
-                return 1
-        else: 
-            return self.m.r.accepts(total)
 
 class Workload:
     def __init__(self):
         self.pid = None
+        self.loads = {}
 
     def prepare(self):
         if opts.data or opts.code:
-            load_opts = {"data": opts.data, "data_dispersion": opts.data_dispersion, "inst": opts.code, "flags": pysweep.MEM_NO_HUGEPAGE}
-            self.load = pysweep.Load(load_opts, verbose=max(0, opts.verbose-1))
-            self.load.start()
+            # Loads are kept suspended between runs and shared by every batch
+            # that uses the same working set
+            key = (opts.data, opts.data_dispersion, opts.code)
+            self.load = self.loads.get(key)
+            if self.load is None:
+                load_opts = {"data": opts.data, "data_dispersion": opts.data_dispersion, "inst": opts.code, "flags": pysweep.MEM_NO_HUGEPAGE}
+                self.load = pysweep.Load(load_opts, verbose=max(0, opts.verbose-1))
+                self.load.start()
+                if opts.verbose:
+                    print("reltest: suspend")
+                self.load.suspend()
+                self.loads[key] = self.load
             self.pid = self.load.tids()[0]
-            if opts.verbose:
-                print("reltest: suspend")
-            self.load.suspend()
         else:
             self.pid = os.getpid()
 
@@ -260,19 +243,24 @@ class Workload:
             # Just sleep for the --sleep duration, e.g. to pick up background system activity
             pysweep.sleep(opts.sleep)
 
-def test_relation(r,x):
+    def close(self):
+        for load in self.loads.values():
+            load.stop()
+        self.loads = {}
+
+
+def measure(rels, x):
     """
-    Test a relationship between events. Because each relationship involves a specific
-    set of events and these all need to be counted at the same time, we run a separate
-    test for each relationship, with just those events configured.
+    Run the workload once with the events of all relationships in rels counting,
+    and store each count in r.counts[x]. Returns the relationships whose
+    reading was multiplexed, which are left for the caller to measure again.
     """
-
     if opts.scaling:
         opts.data = (x + 1) * 100
         opts.code = (x + 1) * 100
 
     g_workload.prepare()
-    m = Monitor(r, x)
+    m = Monitor(rels, x)
     m.enable()
     g_workload.run() # Dynamic code & data gen
     if opts.scaling:
@@ -280,36 +268,59 @@ def test_relation(r,x):
     else:
         pysweep.br_pred(1);
     m.disable()
-    w = m.read()
+    readings = m.read()
     m.close()
 
-    if opts.scaling:
-        if x == 2:  # Update test count on third itration
-            r.n_tests += 1
-            if not w.ok:
-                r.n_fails += 1
-            show_witness(w)
-    else:
+    incomplete = []
+    for (r, rd) in zip(rels, readings):
+        if len(rels) > 1 and rd.is_incomplete():
+            incomplete.append(r)
+        else:
+            r.counts[x] = rd.value if rd.value is not None else 0
+    return incomplete
+
+
+def test_batch(rels):
+    """
+    Test a batch of relationships. Each relationship involves one event; the
+    events of a batch are counted together against the same workload run.
+    A rule whose event could not get a counter for the whole run is measured
+    again on its own, and later batches are shrunk to the size that fitted,
+    so every verdict comes from an unscaled count as with single-rule runs.
+    """
+    for r in rels:
+        r.counts = [0, 0, 0]
+
+    for x in (range(0, 3) if opts.scaling else [0]):
+        incomplete = measure(rels, x)
+        if incomplete:
+            fitted = len(rels) - len(incomplete)
+            opts.batch = max(1, fitted if fitted else len(rels) // 2)
+            if opts.verbose:
+                print("reltest: %d events multiplexed, batch size now %d" % (len(incomplete), opts.batch))
+            for r in incomplete:
+                measure([r], x)
+
+    for r in rels:
+        ok = r.accepts(r.counts)
         r.n_tests += 1
-        if not w.ok:
+        if not ok:
             r.n_fails += 1
-        show_witness(w)
+        show_result(r, ok)
 
-    return w.ok
 
-def show_witness(w):
+def show_result(r, ok):
     # Print more detail about how these values contradict the relationship.
     # (Or perhaps not - when verbose, we also show this for all tests.)
-    r = w.m.r
     if opts.scaling:
-        print(" Rule : %s, event : %04x, count[%08u,%08u,%08u]" % (r.rule, r.sup, total[0], total[1], total[2]), end="")
+        print(" Rule : %s, event : %04x, count[%08u,%08u,%08u]" % (r.rule, r.sup, r.counts[0], r.counts[1], r.counts[2]), end="")
     else :
-        print(" Rule : %s, event : %04x, count[%08u]" % (r.rule, r.sup, total[0]), end="")
+        print(" Rule : %s, event : %04x, count[%08u]" % (r.rule, r.sup, r.counts[0]), end="")
 
     string_revised=r.reason.ljust(30)
     print("  %s" % (string_revised), end="")
 
-    if not w.ok:
+    if not ok:
         print(" :FAIL")
     else:
         print(" :PASS")
@@ -331,19 +342,18 @@ if __name__ == "__main__":
     print("")
     
     for i in range(opts.repeat):
-        for r in rels:
-            total[0] = 0
-            total[1] = 0
-            total[2] = 0
-            if opts.scaling:
-                for x in range(0, 3):
-                    test_relation(r, x)
-            else:
-                test_relation(r, 0)
+        ix = 0
+        while ix < len(rels):
+            batch = rels[ix:ix + max(1, opts.batch)]
+            test_batch(batch)
+            ix += len(batch)
 
+        for r in rels:
             total_tests += r.n_tests
             total_fails += r.n_fails
 
         print("----------------------------------------------------------")
         print(" Total tets: %d , Total Passed: %d, Total Failed: %d" % (total_tests, (total_tests - total_fails), total_fails))
         print("----------------------------------------------------------")
+
+    g_workload.close()
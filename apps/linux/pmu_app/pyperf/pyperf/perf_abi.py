@@ -290,6 +290,22 @@ def non_sample_has_sample_fields(ea):
     return non_sample_sample_type(ea) != 0
 
 
+def iter_record_spans(buf):
+    """
+    Walk a buffer of back-to-back records, as returned by Event.get_records(),
+    yielding (offset, type, misc, size) for each record without copying it.
+    PerfRecord(raw=buf[offset:offset+size]) unpacks a record fully.
+    """
+    pos = 0
+    end = len(buf)
+    while pos + 8 <= end:
+        (type, misc, size) = struct.unpack_from("IHH", buf, pos)
+        if size < 8 or pos + size > end:
+            raise ValueError("corrupt record at offset %u: size %u" % (pos, size))
+        yield (pos, type, misc, size)
+        pos += size
+
+
 class PerfRecord:
     """
     Maps on to "struct perf_event" defined by the perf_event_open syscall ABI.
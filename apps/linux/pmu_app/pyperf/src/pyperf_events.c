@@ -2740,6 +2740,75 @@ static PyObject *event_get_record(PyObject *x)
 }
 
 
+/*
+ * Collect all complete records from the mmap buffer in one go and return them
+ * as a single bytes object, in the same layout as perf.data (each record
+ * starts with its perf_event_header). Returns None if no record is available.
+ *
+ * Unlike get_record(), no Record object or private copy is created per
+ * record: the ring is copied out once (in two parts if it has wrapped) and
+ * data_tail is advanced once, so a high-rate sampling event can be drained
+ * faster than Python could iterate get_record().
+ *
+ * The optional argument caps the number of bytes returned; records are never
+ * split, but a single record larger than the cap is still returned.
+ * PERF_RECORD_AUX records are returned unprocessed - the caller collects the
+ * AUX data they describe with get_aux().
+ */
+static PyObject *event_get_records(PyObject *x, PyObject *args)
+{
+    EventObject *e = (EventObject *)x;
+    unsigned long max_bytes = 0;
+    unsigned long long head, tail, avail, len;
+    struct perf_event_header hdr;
+    PyObject *s;
+
+    if (!PyArg_ParseTuple(args, "|k", &max_bytes)) {
+        return NULL;
+    }
+    if (!e->mmap_page) {
+        Py_RETURN_NONE;
+    }
+    /* Pairs with the kernel's store of data_head: records up to head are complete */
+    head = __atomic_load_n(&e->mmap_page->data_head, __ATOMIC_ACQUIRE);
+    tail = e->mmap_page->data_tail;
+    avail = head - tail;
+    if (avail == 0) {
+        Py_RETURN_NONE;
+    }
+    if (avail > e->mmap_data_size) {
+        fprintf(stderr, "sample buffer corrupt: %llu bytes pending\n", avail);
+        PyErr_SetString(PyExc_ValueError, "sample buffer corrupt");
+        return NULL;
+    }
+    len = avail;
+    if (max_bytes != 0 && avail > max_bytes) {
+        /* Walk the headers to stop on a record boundary */
+        len = 0;
+        while (len < avail) {
+            copy_from_wrapped_buffer(&hdr, e->mmap_data_start, e->mmap_data_size, tail + len, sizeof hdr);
+            if (hdr.size < sizeof hdr || len + hdr.size > avail) {
+                fprintf(stderr, "sample corrupt: length = %ld\n", (long)hdr.size);
+                PyErr_SetString(PyExc_ValueError, "sample buffer corrupt");
+                return NULL;
+            }
+            if (len != 0 && len + hdr.size > max_bytes) {
+                break;
+            }
+            len += hdr.size;
+        }
+    }
+    s = MyBytes_FromStringAndSize(NULL, len);
+    if (!s) {
+        return NULL;
+    }
+    copy_from_wrapped_buffer(MyBytes_AsString(s), e->mmap_data_start, e->mmap_data_size, tail, len);
+    /* Release: our reads of the records complete before the kernel may reuse the space */
+    __atomic_store_n(&e->mmap_page->data_tail, tail + len, __ATOMIC_RELEASE);
+    return s;
+}
+
+
 static PyMethodDef Event_methods[] = {
     {"attr_struct", (PyCFunction)&event_attr_struct, METH_NOARGS, "string: event attributes as raw string"},
     {"fileno", (PyCFunction)&event_fileno, METH_NOARGS, "int: file handle - not for general use"},  /* this makes it a "waitable object" */
@@ -2758,6 +2827,7 @@ static PyMethodDef Event_methods[] = {
     {"poll", (PyCFunction)&event_poll, METH_NOARGS, "bool: test if event record is available"},
     {"is_active", (PyCFunction)&event_is_active, METH_NOARGS, "bool: test if event was closed by kernel"},
     {"get_record", (PyCFunction)&event_get_record, METH_NOARGS, "Record: get next record from a sampling event"},
+    {"get_records", (PyCFunction)&event_get_records, METH_VARARGS, "[int] -> bytes: get all available records from a sampling event"},
     {"get_aux", (PyCFunction)&event_get_aux, METH_NOARGS, "string: get AUX data"},
     {NULL}
 };
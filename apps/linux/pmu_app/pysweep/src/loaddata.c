@@ -360,6 +360,8 @@ void *load_construct_data(Character const *c, struct workload_mem *m)
     m->is_no_hugepage = (c->workload_flags & WL_MEM_NO_HUGEPAGE) != 0;
     m->is_hugepage = (c->workload_flags & WL_MEM_HUGEPAGE) != 0;
     m->is_force_hugepage = (c->workload_flags & WL_MEM_FORCE_HUGEPAGE) != 0;
+    m->is_bind_node = (c->workload_flags & WL_MEM_BIND_NODE) != 0;
+    m->bind_node = c->data_node;
     data = load_alloc_mem(m);
     if (!data) {
         fprintf(stderr, "loadgen: couldn't allocate %llu bytes for data working set\n",
@@ -34,6 +34,8 @@
 #include "denormals.h"
 
 #include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
 #include <unistd.h>
 #include <execinfo.h>
 
@@ -124,6 +126,15 @@ void *load_alloc_mem(struct workload_mem *m)
     if (!m->is_no_hugepage) {
         flags |= MAP_POPULATE;
     }
+    /* Likewise, a NUMA binding only applies to pages faulted in after it
+       is set, so populate explicitly once the area has been bound. */
+    if (m->is_bind_node) {
+        if (m->bind_node >= sizeof(unsigned long) * 8) {
+            fprintf(stderr, "loadgen: NUMA node %u out of range\n", m->bind_node);
+            return NULL;
+        }
+        flags &= ~MAP_POPULATE;
+    }
     m->size = rsize;
     m->base = NULL;
     if (1) {
@@ -186,6 +197,21 @@ void *load_alloc_mem(struct workload_mem *m)
             m->is_no_hugepage = 0;
 #endif
         }        
+        if (m->is_bind_node) {
+            /* Placement was explicitly requested, so if we can't bind, fail
+               rather than measure memory on whatever node we happen to get. */
+            unsigned long nodemask = 1UL << m->bind_node;
+            if (syscall(SYS_mbind, p, rsize, MPOL_BIND, &nodemask, sizeof nodemask * 8, 0) < 0) {
+                perror("mbind");
+                fprintf(stderr, "loadgen: couldn't bind %lu bytes to NUMA node %u\n",
+                    (unsigned long)rsize, m->bind_node);
+                munmap(p, rsize);
+                total_mmap_count -= 1;
+                total_mmap_size -= rsize;
+                return NULL;
+            }
+            memset(p, 0, rsize);
+        }
     }
     m->base = p;
     if (workload_verbose) {
@@ -216,6 +242,46 @@ void load_free_mem(struct workload_mem *m)
 }
 
 
+long workload_data_nodes(Workload const *w, unsigned long *pages, unsigned int n_nodes)
+{
+    /* Query the pages in batches, using move_pages() with no target nodes */
+#define NODE_QUERY_BATCH 512
+    void *addrs[NODE_QUERY_BATCH];
+    int status[NODE_QUERY_BATCH];
+    unsigned long const page_size = sysconf(_SC_PAGESIZE);
+    unsigned long n_pages, i;
+    long n_counted = 0;
+    memset(pages, 0, n_nodes * sizeof(unsigned long));
+    if (w->data_mem.base == NULL) {
+        return 0;
+    }
+    n_pages = round_size_to_pages(w->data_mem.size) / page_size;
+    for (i = 0; i < n_pages; i += NODE_QUERY_BATCH) {
+        unsigned long j, n = n_pages - i;
+        if (n > NODE_QUERY_BATCH) {
+            n = NODE_QUERY_BATCH;
+        }
+        for (j = 0; j < n; ++j) {
+            addrs[j] = (unsigned char *)w->data_mem.base + (i + j) * page_size;
+        }
+        if (syscall(SYS_move_pages, 0, n, addrs, NULL, status, 0) < 0) {
+            if (workload_verbose) {
+                perror("move_pages");
+            }
+            return -1;
+        }
+        for (j = 0; j < n; ++j) {
+            /* Negative status is an errno, e.g. for a page not yet faulted in */
+            if (status[j] >= 0 && (unsigned int)status[j] < n_nodes) {
+                pages[status[j]] += 1;
+                n_counted += 1;
+            }
+        }
+    }
+    return n_counted;
+}
+
+
 /*
 This function has the same API as the workload we create, and can be used
 as a stub when we're diagnosing crashes with the workload.
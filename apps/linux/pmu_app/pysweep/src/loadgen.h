@@ -57,6 +57,8 @@ typedef struct {
     /* Alignment of pointers in the data working set - e.g. 1 for
        byte alignment. Set to 0 for natural alignment. */
     unsigned int data_alignment;
+    /* NUMA node for the data working set, if WL_MEM_BIND_NODE is set. */
+    unsigned int data_node;
     /* Instruction working set in bytes. */
     unsigned long inst_working_set;
     unsigned int inst_mispredict_rate;
@@ -78,6 +80,8 @@ typedef struct {
 #define WL_DEPEND         0x8000    /* Force total dependency chain */
 #define WL_MEM_BARRIER_SYSTEM 0x10000   /* e.g. DMB SY */
 #define WL_MEM_BARRIER_SYNC   0x20000   /* serializing wrt instructions: DSB instead of DMB */
+#define WL_MEM_BIND_NODE      0x40000   /* Allocate the data working set on data_node */
+#define WL_MEM_BIND_LOCAL     0x80000   /* Client binds each thread's data copy to its CPU's node */
     unsigned int workload_flags;   /* WL_xxx flags */
     /* Floating-point intensity - FP ops per memory reference. */
     unsigned int fp_intensity;
@@ -181,6 +185,8 @@ struct workload_mem {
     int is_no_hugepage:1;    /* Forbid allocation as huge pages */
     int is_hugepage:1;       /* Request opportunistic promotion to huge pages if large enough */
     int is_force_hugepage:1; /* Request promotion to huge pages even for small allocations */
+    int is_bind_node:1;      /* Bind the pages to NUMA node bind_node */
+    unsigned int bind_node;
     /* Output */
     void *base;              /* Base virtual address */
     unsigned long size;      /* Size obtained - maybe rounded up to pages etc. */
@@ -238,6 +244,13 @@ void workload_remove_reference(Workload *);
  */
 int workload_free(Workload *);
 
+/*
+ * Count the pages of the data working set resident on each NUMA node.
+ * pages[] has n_nodes entries. Return the number of pages counted,
+ * or -1 if the placement could not be queried.
+ */
+long workload_data_nodes(Workload const *, unsigned long *pages, unsigned int n_nodes);
+
 /*
  * Run the first iteration of a workload in the current thread, and then stop.
  * Multiple threads can concurrently run the same workload.
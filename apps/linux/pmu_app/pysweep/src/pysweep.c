@@ -69,6 +69,7 @@
 #include <sys/mman.h>
 #include <semaphore.h>
 #include <sched.h>
+#include <dirent.h>
 
 #include <assert.h>
 #include <stdlib.h>
@@ -102,12 +103,21 @@ We could do this in different ways:
   - cancel the worker threads (pthread_cancel). Create new threads.
     Disadvantage: any external monitoring, such as perf events, that is tied
     to the worker threads, would have to be set up for the new threads.
+
+We use the first approach. Building a workload (generating code, making it
+executable and building the data working set) is by far the most expensive
+part of an update, and parameter sweeps tend to revisit the same points.
+So each Load keeps a small cache of the workloads it has built, keyed by
+their characteristics. Updating to a previously used specification just
+hands the cached workload back to the threads.
 */
 
 
 typedef struct load_thread load_thread_t;
 typedef struct load_thread_local load_thread_local_t;
 
+#define LOAD_MAX_NODES 64
+
 
 /*
  * pysweep.Load: a Python object representing a workload that we can
@@ -128,6 +138,21 @@ typedef struct {
 #define SUSPEND_ZEROAFF 0x02       /* Suspended because pinned to the empty set of threads */
 #define SUSPEND_BADWORK 0x04       /* Suspended because couldn't create workload */
     pthread_attr_t thread_attr;    /* Default thread attributes (including affinity) */
+    /* Workloads built for this load, most recently used first. The cache
+       owns these; 'work' is either NULL or one of them. */
+#define LOAD_CACHE_DEFAULT 0   /* Opt in: each cached workload keeps its data working set */
+#define LOAD_CACHE_MAX    64
+    unsigned int cache_size;       /* Maximum number of workloads to keep */
+    unsigned int n_cached;         /* Number of workloads in the cache */
+    Character cache_char[LOAD_CACHE_MAX];  /* Characteristics as requested */
+    Workload *cache_work[LOAD_CACHE_MAX];
+    /* Per-thread CPU placement: thread i is pinned to place_cpus[i % n_place_cpus] */
+    unsigned int n_place_cpus;     /* Zero if threads share thread_attr affinity */
+    unsigned int *place_cpus;
+    /* Copies of 'work' with the data working set bound to one NUMA node,
+       for WL_MEM_BIND_LOCAL. Built on first use, dropped when 'work' changes. */
+    Workload *node_work_of;        /* Workload the copies were built from */
+    Workload *node_work[LOAD_MAX_NODES];
 } LoadObject;
 
 
@@ -142,6 +167,7 @@ struct load_thread {
     struct load_thread *next_thread;
     LoadObject *load;             /* Point back to the load */
     pthread_t pthread_id;         /* The pthread thread id, not the OS thread id */
+    unsigned int index;           /* Creation order, for placement */
     pid_t os_tid;                 /* OS tid, as used for e.g. perf_event_open */
     sem_t sem_started;            /* Thread has started and OS tid is available */
     sem_t sem_worktodo;           /* Contoller signals thread that there is work to do */
@@ -161,6 +187,7 @@ struct load_thread_local {
     struct load_thread *thread;   /* Point back to the thread */
     Workload *volatile vol_work;  /* Copy of the workload - NULL if nothing to run */
     unsigned int volatile n_iters;/* Number of times through this workload */
+    unsigned long volatile n_bytes;  /* Expected data bytes read and written */
 };
 
 
@@ -184,11 +211,85 @@ static PyObject *load_new(PyTypeObject *t, PyObject *args, PyObject *kwds)
     p->first_thread = NULL;
     p->suspend_reasons = 0;
     p->work = NULL;
+    p->cache_size = LOAD_CACHE_DEFAULT;
+    p->n_cached = 0;
+    p->n_place_cpus = 0;
+    p->place_cpus = NULL;
+    p->node_work_of = NULL;
+    memset(p->node_work, 0, sizeof p->node_work);
     pthread_attr_init(&p->thread_attr);
     return (PyObject *)p;
 }
 
 
+/*
+ * Look for a previously built workload with exactly these characteristics.
+ * Both the key and the cached copy were set up by workload_init() and
+ * setup_char(), so any padding is zero and they can be compared bytewise.
+ * A hit is moved to the front of the cache.
+ */
+static Workload *load_cache_lookup(LoadObject *p, Character const *c)
+{
+    unsigned int i;
+    for (i = 0; i < p->n_cached; ++i) {
+        if (!memcmp(&p->cache_char[i], c, sizeof(Character))) {
+            Workload *w = p->cache_work[i];
+            memmove(&p->cache_char[1], &p->cache_char[0], i * sizeof(Character));
+            memmove(&p->cache_work[1], &p->cache_work[0], i * sizeof(Workload *));
+            memcpy(&p->cache_char[0], c, sizeof(Character));
+            p->cache_work[0] = w;
+            return w;
+        }
+    }
+    return NULL;
+}
+
+
+/*
+ * Add a newly built workload to the front of the cache, evicting the least
+ * recently used workload if the cache is full. The current workload is
+ * always at the front, so it is never the one evicted. An evicted workload
+ * may still be running on a worker that has not yet picked up the new one;
+ * workload_free() defers destruction until it has.
+ */
+static void load_cache_insert(LoadObject *p, Character const *c, Workload *w)
+{
+    unsigned int limit = (p->cache_size > 0) ? p->cache_size : 1;
+    while (p->n_cached >= limit) {
+        --p->n_cached;
+        if (workload_verbose) {
+            fprintf(stderr, "pysweep: evicting cached workload %p\n", p->cache_work[p->n_cached]);
+        }
+        workload_free(p->cache_work[p->n_cached]);
+    }
+    memmove(&p->cache_char[1], &p->cache_char[0], p->n_cached * sizeof(Character));
+    memmove(&p->cache_work[1], &p->cache_work[0], p->n_cached * sizeof(Workload *));
+    memcpy(&p->cache_char[0], c, sizeof(Character));
+    p->cache_work[0] = w;
+    ++p->n_cached;
+}
+
+
+/*
+ * Free all cached workloads other than the current one.
+ * If keep_current is zero, free the current one too.
+ */
+static void load_cache_flush(LoadObject *p, int keep_current)
+{
+    unsigned int i, n_kept = 0;
+    for (i = 0; i < p->n_cached; ++i) {
+        if (keep_current && p->cache_work[i] == p->work) {
+            memcpy(&p->cache_char[n_kept], &p->cache_char[i], sizeof(Character));
+            p->cache_work[n_kept] = p->cache_work[i];
+            ++n_kept;
+        } else {
+            workload_free(p->cache_work[i]);
+        }
+    }
+    p->n_cached = n_kept;
+}
+
+
 /*
 Given a Python dictionary object of characteristics, update a loadgen
 characteristics structure.
@@ -287,6 +388,26 @@ static int setup_char(PyObject *spec, Character *c)
     if (rc) return rc;
     rc = update_field_float(&c->fp_value2, spec, "fp_value2");
     if (rc) return rc;
+    /* A data node, if given, binds the data working set to that node.
+       A negative node gives each placed thread a copy of the data working
+       set bound to the node of its CPU. */
+    {
+        PyObject *onode = PyDict_GetItemString(spec, "data_node");
+        if (onode != NULL && onode != Py_None) {
+            long node = PyInt_AsLong(onode);
+            if (PyErr_Occurred()) {
+                return -1;
+            }
+            c->workload_flags &= ~(WL_MEM_BIND_NODE|WL_MEM_BIND_LOCAL);
+            if (node < 0) {
+                c->data_node = 0;
+                c->workload_flags |= WL_MEM_BIND_LOCAL;
+            } else {
+                c->data_node = (unsigned int)node;
+                c->workload_flags |= WL_MEM_BIND_NODE;
+            }
+        }
+    }
     /* Force the instruction working set to a suitable minimum? */
 #define MINIMUM_INST_WORKING_SET 64
     if (c->inst_working_set < MINIMUM_INST_WORKING_SET) {
@@ -307,15 +428,16 @@ static int load_init(PyObject *x, PyObject *args, PyObject *kwds)
 {
     LoadObject *p = (LoadObject *)x;
     PyObject *spec = NULL;
-    static char *keys[] = { "spec", "threads", "verbose", NULL };
+    static char *keys[] = { "spec", "threads", "verbose", "cache", NULL };
     int verbose = 0;
     int n_threads = p->n_threads;    /* load_new will have defaulted this to 1 */
+    int cache_size = p->cache_size;  /* Number of built workloads to keep */
     Character c;
     /* The default workload characteristics have no data and no FP operations.
        setup_char() will default the code working set to at least 1024 bytes. */
     workload_init(&c);
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|ii", keys, &spec, &n_threads, &verbose)) {
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|iii", keys, &spec, &n_threads, &verbose, &cache_size)) {
         return -1;
     }
     assert(spec != NULL);
@@ -329,6 +451,12 @@ static int load_init(PyObject *x, PyObject *args, PyObject *kwds)
     }
     p->n_threads = n_threads;
 
+    if (cache_size < 0 || cache_size > LOAD_CACHE_MAX) {
+        PyErr_SetString(PyExc_ValueError, "cache size out of range");
+        return -1;
+    }
+    p->cache_size = cache_size;
+
     if (verbose) {
         workload_verbose = verbose;
         fprintf(stderr, "pysweep: setting verbosity level to %d\n", verbose);
@@ -339,6 +467,7 @@ static int load_init(PyObject *x, PyObject *args, PyObject *kwds)
         PyErr_SetString(PyExc_RuntimeError, "load could not be created");
         return -1;
     }
+    load_cache_insert(p, &c, p->work);
     if (workload_verbose) {
         fprintf(stderr, "pysweep: %p: workload created\n", p->work);
     }
@@ -488,6 +617,7 @@ static void *thread_start(void *ltv)
     LoadObject const *const lob = lt->load;
     Workload *last_work = NULL;
     void *work_data = NULL;
+    unsigned long work_bytes = 0;
     int otype;
     /* The tid of this worker thread can be used to control it and also appears
        in diagnostic messages. */
@@ -533,6 +663,7 @@ static void *thread_start(void *ltv)
                 work = loc->vol_work;
             }           
             work_data = work->entry_args[0];  /* Reset - including first time round */
+            work_bytes = work->expected.n[COUNT_BYTES_RD] + work->expected.n[COUNT_BYTES_WR];
             if (workload_verbose) {
                 /* Report that the workload for the worker threads changed. */
                 fprintf(stderr, "pysweep: [W %u] workload updated to code=%p with argument data=%p\n",
@@ -549,6 +680,7 @@ static void *thread_start(void *ltv)
         work_data = workload_run(work, work_data, N_ITERS);
         /* Update iteration count for this thread */
         loc->n_iters += N_ITERS;
+        loc->n_bytes += N_ITERS * work_bytes;
         /* TBD: should we put a memory fence here to flush the store? */
     }
     /* Don't expect to get here? */
@@ -563,6 +695,90 @@ static PyObject *thread_new(PyTypeObject *ot, PyObject *args, PyObject *kwds)
 }
 
 
+/*
+ * Find the NUMA node of a CPU from sysfs. Return -1 if not known,
+ * e.g. on a kernel built without NUMA support.
+ */
+static int cpu_node(int cpu)
+{
+    char path[64];
+    DIR *d;
+    struct dirent *e;
+    int node = -1;
+    if (cpu < 0) {
+        return -1;
+    }
+    snprintf(path, sizeof path, "/sys/devices/system/cpu/cpu%d", cpu);
+    d = opendir(path);
+    if (d == NULL) {
+        return -1;
+    }
+    while ((e = readdir(d)) != NULL) {
+        if (sscanf(e->d_name, "node%d", &node) == 1) {
+            break;
+        }
+        node = -1;
+    }
+    closedir(d);
+    return node;
+}
+
+
+/*
+ * Free the node-local copies of the load's workload. Threads still
+ * running a copy keep it alive until they move on.
+ */
+static void load_node_work_flush(LoadObject *p)
+{
+    unsigned int n;
+    for (n = 0; n < LOAD_MAX_NODES; ++n) {
+        if (p->node_work[n] != NULL) {
+            workload_free(p->node_work[n]);
+            p->node_work[n] = NULL;
+        }
+    }
+    p->node_work_of = NULL;
+}
+
+
+/*
+ * Choose the workload a thread should run when the load's workload is w.
+ * For WL_MEM_BIND_LOCAL, a thread placed on a CPU runs a copy of w whose data
+ * working set is bound to that CPU's node, so its data accesses stay local.
+ * Threads without a placement, or whose node is unknown, run w itself.
+ */
+static Workload *load_thread_workload(LoadObject *p, load_thread_t const *lt, Workload *w)
+{
+    Character c;
+    int node;
+    if (w == NULL || !(w->c.workload_flags & WL_MEM_BIND_LOCAL) || p->n_place_cpus == 0) {
+        return w;
+    }
+    if (p->node_work_of != w) {
+        load_node_work_flush(p);
+        p->node_work_of = w;
+    }
+    node = cpu_node(p->place_cpus[lt->index % p->n_place_cpus]);
+    if (node < 0 || node >= LOAD_MAX_NODES) {
+        return w;
+    }
+    if (p->node_work[node] == NULL) {
+        c = w->c;
+        c.workload_flags = (c.workload_flags & ~WL_MEM_BIND_LOCAL) | WL_MEM_BIND_NODE;
+        c.data_node = (unsigned int)node;
+        p->node_work[node] = workload_create(&c);
+        if (p->node_work[node] == NULL) {
+            fprintf(stderr, "pysweep: couldn't build workload for NUMA node %d, thread data will not be local\n", node);
+            return w;
+        }
+        if (workload_verbose) {
+            fprintf(stderr, "pysweep: %p: built copy %p with data on node %d\n", w, p->node_work[node], node);
+        }
+    }
+    return p->node_work[node];
+}
+
+
 /*
  * Update all threads' local copy of the workload.
  * This might be called with NULL, to temporarily stop a thread
@@ -572,18 +788,44 @@ static void load_update_thread_work(LoadObject *p, Workload *w)
 {
     load_thread_t *t;
     for (t = p->first_thread; t != NULL; t = t->next_thread) {
+        Workload *tw = load_thread_workload(p, t, w);
         int was_null = (t->loc->vol_work == NULL);
-        if (w != NULL) {
-            workload_add_reference(w);
+        if (tw == t->loc->vol_work) {
+            /* Already running it: don't take another reference */
+            continue;
+        }
+        if (tw != NULL) {
+            workload_add_reference(tw);
         }
-        t->loc->vol_work = w;
-        if (w != NULL && was_null) {
+        t->loc->vol_work = tw;
+        if (tw != NULL && was_null) {
             sem_post(&t->sem_worktodo);
         }
     }
 }
 
 
+/*
+ * Pin a thread to its CPU from the load's placement list, if there is one.
+ * Return 0 on success (or nothing to do), otherwise the sched_setaffinity() result.
+ */
+static int thread_place(LoadObject const *p, load_thread_t const *lt)
+{
+    cpu_set_t cpus;
+    if (p->n_place_cpus == 0) {
+        return 0;
+    }
+    CPU_ZERO(&cpus);
+    CPU_SET(p->place_cpus[lt->index % p->n_place_cpus], &cpus);
+    if (workload_verbose) {
+        fprintf(stderr, "pysweep: [* %u] placing worker thread [W %u] on CPU %u\n",
+            (unsigned int)gettid(), (unsigned int)lt->os_tid,
+            p->place_cpus[lt->index % p->n_place_cpus]);
+    }
+    return sched_setaffinity(lt->os_tid, sizeof cpus, &cpus);
+}
+
+
 /*
  * Create the worker threads for the load, using pthread_create().
  */
@@ -613,11 +855,13 @@ static PyObject *load_start(PyObject *x)
         lt->loc = loc;
         loc->thread = lt;
         lt->load = p;
+        lt->index = i;
         sem_init(&lt->sem_started, 0, 0);
         sem_init(&lt->sem_worktodo, 0, 0);
         lt->os_tid = 0;    /* don't know it yet, will be found in-thread */
         loc->vol_work = NULL;
         loc->n_iters = 0;
+        loc->n_bytes = 0;
         lt->next_thread = p->first_thread;
         p->first_thread = lt;        
         rc = pthread_create(&lt->pthread_id, &p->thread_attr, &thread_start, lt);
@@ -644,6 +888,10 @@ static PyObject *load_start(PyObject *x)
             sem_wait(&lt->sem_started);
             /* The thread should have started and recorded its tid. */
             assert(lt->os_tid > 0);
+            /* It hasn't touched any workload yet, so pin it now. */
+            if (thread_place(p, lt) != 0) {
+                perror("sched_setaffinity");
+            }
             if (workload_verbose) {
                 fprintf(stderr, "pysweep: [* %u] has noted start of worker thread [W %u]\n",
                     (unsigned int)gettid(), (unsigned int)lt->os_tid);
@@ -755,10 +1003,10 @@ static PyObject *load_release_internal(LoadObject *p, unsigned int reason)
 
 /*
  * Update the characteristics of an active workload object.
- * This will generally involve creating a new workload,
- * and deleting the old workload.
- * Active threads may be running the old workload,
- * so its destruction may be deferred.
+ * If the load has already built a workload with these characteristics
+ * it is reused; otherwise a new workload is created and cached.
+ * Active threads may be running the old workload. It stays in the cache,
+ * or if evicted, its destruction is deferred until they have moved on.
  */
 static PyObject *load_update(PyObject *x, PyObject *args)
 {
@@ -769,15 +1017,25 @@ static PyObject *load_update(PyObject *x, PyObject *args)
     if (!PyArg_ParseTuple(args, "O", &spec)) {
         return NULL;
     }
-    if (workload_verbose) {
-        fprintf(stderr, "pysweep: creating new workload for spec update\n");
-    }
     workload_init(&c);
     if (setup_char(spec, &c)) {
         return NULL;
     }
-    /* Try to create a new workload with these characteristics. */
-    w = workload_create(&c);
+    w = load_cache_lookup(p, &c);
+    if (w != NULL) {
+        if (workload_verbose) {
+            fprintf(stderr, "pysweep: reusing cached workload %p for spec update\n", w);
+        }
+    } else {
+        if (workload_verbose) {
+            fprintf(stderr, "pysweep: creating new workload for spec update\n");
+        }
+        /* Try to create a new workload with these characteristics. */
+        w = workload_create(&c);
+        if (w != NULL) {
+            load_cache_insert(p, &c, w);
+        }
+    }
     /* Update the workload. At some point the worker threads will pick up this
        new workload and start running it. It's possible that we failed
        to create the workload and that w is NULL. */
@@ -789,13 +1047,9 @@ static PyObject *load_update(PyObject *x, PyObject *args)
         /* TBD: perhaps we should wait until the threads have suspended */
     } else if (w_old == NULL && w != NULL) {
         load_release_internal(p, SUSPEND_BADWORK);
-    } else if (!p->suspend_reasons) {
+    } else if (w != w_old && !p->suspend_reasons) {
         load_update_thread_work(p, w);
     }
-    if (workload_verbose) {
-        fprintf(stderr, "pysweep: destroying old workload %p\n", w_old);
-    }
-    workload_free(w_old);     /* Will be deferred until no longer in use */    
     if (workload_verbose) {
         fprintf(stderr, "pysweep: workload updated\n");
     }
@@ -1004,7 +1258,7 @@ static PyObject *thread_iterations(PyObject *x)
  * Set CPU affinity for the current workload. Affinity is supplied as a bitmask.
  * The threads of the workload are each free to use any of the given CPUs.
  * The set may be zero in which case the workload is suspended.
- * TBD: allow fine-grained pinning of individual threads.
+ * This replaces any per-thread placement set with place().
  */
 static PyObject *load_setaffinity(PyObject *x, PyObject *mask)
 {
@@ -1018,6 +1272,9 @@ static PyObject *load_setaffinity(PyObject *x, PyObject *mask)
     /* Set the affinity in the thread attributes. If we haven't created
        the threads yet, they will pick it up from here. */
     pthread_attr_setaffinity_np(&p->thread_attr, sizeof affinity, &affinity);
+    free(p->place_cpus);
+    p->place_cpus = NULL;
+    p->n_place_cpus = 0;
 
     /* Update running threads. We might not have started any threads yet. */
 
@@ -1034,6 +1291,10 @@ static PyObject *load_setaffinity(PyObject *x, PyObject *mask)
             return NULL;
         }
     }
+    /* Without a placement, threads go back to the shared workload */
+    if (!p->suspend_reasons) {
+        load_update_thread_work(p, p->work);
+    }
 
     return load_release_internal(p, SUSPEND_ZEROAFF);
 }
@@ -1047,6 +1308,221 @@ static PyObject *load_getaffinity(PyObject *x)
 }
 
 
+/*
+ * Pin each thread of the workload to one CPU: thread i (in creation order)
+ * goes on the i'th CPU of the list, wrapping round if there are more threads
+ * than CPUs. An empty list or None removes the placement, but leaves the
+ * threads where they are until the next setaffinity().
+ */
+static PyObject *load_place(PyObject *x, PyObject *cpus)
+{
+    LoadObject *p = (LoadObject *)x;
+    load_thread_t *t;
+    unsigned int *place = NULL;
+    unsigned int i, n = 0;
+    if (cpus != Py_None) {
+        if (!PyList_Check(cpus)) {
+            PyErr_SetString(PyExc_TypeError, "Expected list of CPUs");
+            return NULL;
+        }
+        n = PyList_Size(cpus);
+    }
+    if (n > 0) {
+        place = (unsigned int *)malloc(n * sizeof(unsigned int));
+        if (place == NULL) {
+            return PyErr_NoMemory();
+        }
+        for (i = 0; i < n; ++i) {
+            long cpu = PyInt_AsLong(PyList_GET_ITEM(cpus, i));
+            if (PyErr_Occurred()) {
+                free(place);
+                return NULL;
+            }
+            if (cpu < 0 || cpu >= CPU_SETSIZE) {
+                free(place);
+                PyErr_SetString(PyExc_ValueError, "CPU number out of range");
+                return NULL;
+            }
+            place[i] = cpu;
+        }
+    }
+    free(p->place_cpus);
+    p->place_cpus = place;
+    p->n_place_cpus = n;
+    for (t = p->first_thread; t != NULL; t = t->next_thread) {
+        if (thread_place(p, t) != 0) {
+            PyErr_SetString(PyExc_RuntimeError, "sched_setaffinity failed");
+            return NULL;
+        }
+    }
+    /* Threads that moved node pick up the copy of the data for their node */
+    if (!p->suspend_reasons) {
+        load_update_thread_work(p, p->work);
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*
+ * Find the CPU a thread last ran on: field 39 of /proc/<pid>/task/<tid>/stat.
+ * Return -1 if not known.
+ */
+static int thread_cpu(pid_t tid)
+{
+    char path[64];
+    char buf[1024];
+    char const *s;
+    FILE *fd;
+    int field, cpu = -1;
+    snprintf(path, sizeof path, "/proc/self/task/%d/stat", (int)tid);
+    fd = fopen(path, "r");
+    if (fd == NULL) {
+        return -1;
+    }
+    s = fgets(buf, sizeof buf, fd);
+    fclose(fd);
+    /* The command name (field 2) is bracketed and may contain spaces */
+    if (s == NULL || (s = strrchr(buf, ')')) == NULL) {
+        return -1;
+    }
+    for (field = 2; field < 39 && s != NULL; ++field) {
+        s = strchr(s + 1, ' ');
+    }
+    if (s != NULL) {
+        cpu = atoi(s + 1);
+    }
+    return cpu;
+}
+
+
+/*
+ * Store value under key in dict, taking over the caller's references to both.
+ * Either may be NULL after a failed allocation, which is reported as an error.
+ */
+static int dict_set_steal(PyObject *dict, PyObject *key, PyObject *value)
+{
+    int rc = -1;
+    if (key != NULL && value != NULL) {
+        rc = PyDict_SetItem(dict, key, value);
+    }
+    Py_XDECREF(key);
+    Py_XDECREF(value);
+    return rc;
+}
+
+
+static int dict_set_string_steal(PyObject *dict, char const *name, PyObject *value)
+{
+    int rc = -1;
+    if (value != NULL) {
+        rc = PyDict_SetItemString(dict, name, value);
+    }
+    Py_XDECREF(value);
+    return rc;
+}
+
+
+/*
+ * Report NUMA placement of the workload and an estimate of the data
+ * access volume it has generated so far:
+ *
+ *   "data":             { node: pages }  - where the load's data working set is resident
+ *   "threads":          { tid: { "cpu", "node", "est_access_bytes" } }
+ *   "est_access_bytes": { (cpu_node, mem_node): bytes }
+ *
+ * The byte counts are not measured traffic. They are the workload's expected
+ * data bytes per iteration times iterations, including accesses that hit in
+ * the caches, split across memory nodes in proportion to the pages of the
+ * data working set the thread is running on. Use PMU memory-traffic events
+ * for measured per-node bandwidth. The counts are cumulative.
+ */
+static PyObject *load_numa(PyObject *x)
+{
+    LoadObject *p = (LoadObject *)x;
+    load_thread_t *t;
+    Workload *pages_of = NULL;
+    unsigned long pages[LOAD_MAX_NODES];
+    long n_pages = 0;
+    unsigned int n;
+    PyObject *data = PyDict_New();
+    PyObject *threads = PyDict_New();
+    PyObject *access = PyDict_New();
+    PyObject *r = PyDict_New();
+
+    if (data == NULL || threads == NULL || access == NULL || r == NULL) {
+        goto fail;
+    }
+    if (p->work != NULL) {
+        n_pages = workload_data_nodes(p->work, pages, LOAD_MAX_NODES);
+        pages_of = p->work;
+    }
+    for (n = 0; n_pages > 0 && n < LOAD_MAX_NODES; ++n) {
+        if (pages[n] > 0) {
+            if (dict_set_steal(data, PyInt_FromLong(n), PyInt_FromLong(pages[n])) < 0) {
+                goto fail;
+            }
+        }
+    }
+    for (t = p->first_thread; t != NULL; t = t->next_thread) {
+        int cpu = thread_cpu(t->os_tid);
+        int node = cpu_node(cpu);
+        unsigned long bytes = t->loc->n_bytes;
+        /* A thread with node-local data runs its own copy of the workload */
+        Workload *w = (t->loc->vol_work != NULL) ? t->loc->vol_work : p->work;
+        PyObject *tinfo = PyDict_New();
+        if (tinfo == NULL) {
+            goto fail;
+        }
+        if (dict_set_string_steal(tinfo, "cpu", PyInt_FromLong(cpu)) < 0 ||
+            dict_set_string_steal(tinfo, "node", PyInt_FromLong(node)) < 0 ||
+            dict_set_string_steal(tinfo, "est_access_bytes", PyLong_FromUnsignedLong(bytes)) < 0 ||
+            dict_set_steal(threads, PyInt_FromLong(t->os_tid), tinfo) < 0) {
+            goto fail;
+        }
+        if (w != NULL && w != pages_of) {
+            n_pages = workload_data_nodes(w, pages, LOAD_MAX_NODES);
+            pages_of = w;
+        }
+        for (n = 0; n_pages > 0 && n < LOAD_MAX_NODES; ++n) {
+            if (pages[n] > 0) {
+                PyObject *key = Py_BuildValue("(ii)", node, n);
+                PyObject *old;
+                double b = (double)bytes * pages[n] / n_pages;
+                if (key == NULL) {
+                    goto fail;
+                }
+                old = PyDict_GetItem(access, key);    /* borrowed */
+                if (old != NULL) {
+                    b += PyFloat_AsDouble(old);
+                }
+                if (dict_set_steal(access, key, PyFloat_FromDouble(b)) < 0) {
+                    goto fail;
+                }
+            }
+        }
+    }
+    if (PyDict_SetItemString(r, "data", data) < 0 ||
+        PyDict_SetItemString(r, "threads", threads) < 0 ||
+        PyDict_SetItemString(r, "est_access_bytes", access) < 0) {
+        goto fail;
+    }
+    Py_DECREF(data);
+    Py_DECREF(threads);
+    Py_DECREF(access);
+    return r;
+
+fail:
+    Py_XDECREF(data);
+    Py_XDECREF(threads);
+    Py_XDECREF(access);
+    Py_XDECREF(r);
+    if (!PyErr_Occurred()) {
+        PyErr_NoMemory();
+    }
+    return NULL;
+}
+
+
 /*
  * Set affinity for a single thread.
  */
@@ -1192,6 +1668,23 @@ static PyObject *load_dump(PyObject *x, PyObject *args)
 }
 
 
+/*
+ * Release the memory held by cached workloads other than the current one.
+ */
+static PyObject *load_flush(PyObject *x)
+{
+    load_cache_flush((LoadObject *)x, 1);
+    Py_RETURN_NONE;
+}
+
+
+static PyObject *load_cached(PyObject *x)
+{
+    LoadObject *p = (LoadObject *)x;
+    return PyInt_FromLong(p->n_cached);
+}
+
+
 static void load_dealloc(PyObject *x)
 {
     LoadObject *p = (LoadObject *)x;
@@ -1200,8 +1693,11 @@ static void load_dealloc(PyObject *x)
     }
     (void)load_stop(x);
     /* Any worker threads have now been cancelled and joined,
-       so it's safe to free the workload. */
-    workload_free(p->work);
+       so it's safe to free the workloads. */
+    load_cache_flush(p, 0);
+    load_node_work_flush(p);
+    p->work = NULL;
+    free(p->place_cpus);
     pthread_attr_destroy(&p->thread_attr);
     /* "finally (as its last action) call the type's tp_free function." */
     x->ob_type->tp_free(x);
@@ -1220,6 +1716,8 @@ static PyMethodDef Load_methods[] = {
     {"update", (PyCFunction)&load_update, METH_VARARGS, "spec -> None: update load specification"},
     {"setaffinity", (PyCFunction)&load_setaffinity, METH_O, "list or mask -> None: set CPU affinity mask for workload"},
     {"getaffinity", (PyCFunction)&load_getaffinity, METH_NOARGS, "list: get CPU affinity"},
+    {"place", (PyCFunction)&load_place, METH_O, "list -> None: pin thread i to the i'th CPU in the list"},
+    {"numa", (PyCFunction)&load_numa, METH_NOARGS, "{}: NUMA placement and estimated per-node data access volume"},
     {"stop", (PyCFunction)&load_stop, METH_NOARGS, "None: stop (cancel) load threads"},
     {"suspend", (PyCFunction)&load_suspend, METH_NOARGS, "None: suspend load threads"},
     {"resume", (PyCFunction)&load_resume, METH_NOARGS, "None: resume load threads"},
@@ -1231,6 +1729,8 @@ static PyMethodDef Load_methods[] = {
     {"tids", (PyCFunction)&load_tids, METH_NOARGS, "[tids]: get OS thread ids"},
     {"expected", (PyCFunction)&load_expected, METH_NOARGS, "{}: get expected instruction counts"},
     {"dump", (PyCFunction)&load_dump, METH_VARARGS, "str -> int: generate program image file"},
+    {"cached", (PyCFunction)&load_cached, METH_NOARGS, "int: number of cached workloads"},
+    {"flush", (PyCFunction)&load_flush, METH_NOARGS, "None: free cached workloads other than the current one"},
     {NULL}
 };
 
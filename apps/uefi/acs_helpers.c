@@ -622,6 +622,22 @@ command_init (void)
         policy->print_mmio = FALSE;
     }
 
+    /* Rule timing profile report format */
+    CmdLineArg  = ShellCommandLineGetValue (ParamPackage, L"-profile");
+    if (CmdLineArg != NULL) {
+        if (w_ascii_streq_caseins(CmdLineArg, L"summary")) {
+            policy->profile_format = PROFILE_FORMAT_SUMMARY;
+        } else if (w_ascii_streq_caseins(CmdLineArg, L"json")) {
+            policy->profile_format = PROFILE_FORMAT_JSON;
+        } else if (w_ascii_streq_caseins(CmdLineArg, L"csv")) {
+            policy->profile_format = PROFILE_FORMAT_CSV;
+        } else {
+            Print(L"Invalid value for -profile. Use 'summary', 'json' or 'csv'\n");
+            HelpMsg();
+            return SHELL_INVALID_PARAMETER;
+        }
+    }
+
     /* -f logfile option */
     CmdLineArg  = ShellCommandLineGetValue (ParamPackage, L"-f");
     if (CmdLineArg == NULL) {
@@ -1139,7 +1155,9 @@ createPeInfoTable (
 
     PeInfoTable = val_aligned_alloc(SIZE_4K, PE_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("PE");
     Status = val_pe_create_info_table(PeInfoTable);
+    rule_profile_phase_end();
 
     return Status;
 }
@@ -1153,7 +1171,9 @@ createGicInfoTable (
 
     GicInfoTable = val_aligned_alloc(SIZE_4K, GIC_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("GIC");
     Status = val_gic_create_info_table(GicInfoTable);
+    rule_profile_phase_end();
 
     return Status;
 }
@@ -1166,7 +1186,9 @@ createTimerInfoTable(
 
     TimerInfoTable = val_aligned_alloc(SIZE_4K, TIMER_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("TIMER");
     val_timer_create_info_table(TimerInfoTable);
+    rule_profile_phase_end();
 }
 
 VOID
@@ -1177,7 +1199,9 @@ createWatchdogInfoTable(
 
     WdInfoTable = val_aligned_alloc(SIZE_4K, WD_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("WATCHDOG");
     val_wd_create_info_table(WdInfoTable);
+    rule_profile_phase_end();
 }
 
 
@@ -1190,11 +1214,15 @@ createPcieVirtInfoTable(
 
     PcieInfoTable   = val_aligned_alloc(SIZE_4K, PCIE_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("PCIE");
     val_pcie_create_info_table(PcieInfoTable);
+    rule_profile_phase_end();
 
     IoVirtInfoTable = val_aligned_alloc(SIZE_4K, IOVIRT_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("IOVIRT");
     val_iovirt_create_info_table(IoVirtInfoTable);
+    rule_profile_phase_end();
 }
 
 VOID
@@ -1205,7 +1233,9 @@ createCxlInfoTable(
 
   CxlInfoTable = val_aligned_alloc(SIZE_4K, CXL_INFO_TBL_SZ);
 
+  rule_profile_phase_begin("CXL");
   val_cxl_create_info_table(CxlInfoTable);
+  rule_profile_phase_end();
 }
 
 VOID
@@ -1217,11 +1247,15 @@ createPeripheralInfoTable(
 
     PeripheralInfoTable = val_aligned_alloc(SIZE_4K, PERIPHERAL_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("PERIPHERAL");
     val_peripheral_create_info_table(PeripheralInfoTable);
+    rule_profile_phase_end();
 
     MemoryInfoTable = val_aligned_alloc(SIZE_4K, MEM_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("MEMORY");
     val_memory_create_info_table(MemoryInfoTable);
+    rule_profile_phase_end();
 }
 
 VOID
@@ -1232,7 +1266,9 @@ createSmbiosInfoTable(
 
     SmbiosInfoTable = val_aligned_alloc(SIZE_4K, SMBIOS_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("SMBIOS");
     val_smbios_create_info_table(SmbiosInfoTable);
+    rule_profile_phase_end();
 }
 
 VOID
@@ -1243,7 +1279,9 @@ createPmuInfoTable(
 
     PmuInfoTable = val_aligned_alloc(SIZE_4K, PMU_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("PMU");
     val_pmu_create_info_table(PmuInfoTable);
+    rule_profile_phase_end();
 }
 
 UINT32
@@ -1255,7 +1293,9 @@ createRasInfoTable(
 
     RasInfoTable = val_aligned_alloc(SIZE_4K, RAS_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("RAS");
     status = val_ras_create_info_table(RasInfoTable);
+    rule_profile_phase_end();
 
     return status;
 }
@@ -1268,7 +1308,9 @@ createCacheInfoTable(
 
     CacheInfoTable = val_aligned_alloc(SIZE_4K, CACHE_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("CACHE");
     val_cache_create_info_table(CacheInfoTable);
+    rule_profile_phase_end();
 }
 
 VOID
@@ -1279,7 +1321,9 @@ createMpamInfoTable(
 
     MpamInfoTable = val_aligned_alloc(SIZE_4K, MPAM_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("MPAM");
     val_mpam_create_info_table(MpamInfoTable);
+    rule_profile_phase_end();
 }
 
 VOID
@@ -1290,7 +1334,9 @@ createHmatInfoTable(
 
     HmatInfoTable = val_aligned_alloc(SIZE_4K, HMAT_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("HMAT");
     val_hmat_create_info_table(HmatInfoTable);
+    rule_profile_phase_end();
 }
 
 VOID
@@ -1301,7 +1347,9 @@ createSratInfoTable(
 
     SratInfoTable = val_aligned_alloc(SIZE_4K, SRAT_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("SRAT");
     val_srat_create_info_table(SratInfoTable);
+    rule_profile_phase_end();
 }
 
 VOID
@@ -1312,7 +1360,9 @@ createPccInfoTable(
 
     PccInfoTable = val_aligned_alloc(SIZE_4K, PCC_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("PCC");
     val_pcc_create_info_table(PccInfoTable);
+    rule_profile_phase_end();
 }
 
 VOID
@@ -1323,7 +1373,9 @@ createRas2InfoTable(
 
     Ras2InfoTable = val_aligned_alloc(SIZE_4K, RAS2_FEAT_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("RAS2");
     val_ras2_create_info_table(Ras2InfoTable);
+    rule_profile_phase_end();
 }
 
 VOID
@@ -1334,7 +1386,9 @@ createTpm2InfoTable(
 
     Tpm2InfoTable = val_aligned_alloc(SIZE_4K, TPM2_INFO_TBL_SZ);
 
+    rule_profile_phase_begin("TPM2");
     val_tpm2_create_info_table(Tpm2InfoTable);
+    rule_profile_phase_end();
 }
 
 VOID
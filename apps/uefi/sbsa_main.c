@@ -41,6 +41,7 @@ CONST SHELL_PARAM_ITEM ParamList[] = {
     {L"-no_crypto_ext", TypeFlag},
     {L"-only", TypeValue},
     {L"-p2p", TypeFlag},
+    {L"-profile", TypeValue},
     {L"-r", TypeValue},
     {L"-skip", TypeValue},
     {L"-skip-dp-nic-ms", TypeFlag},
@@ -79,6 +80,8 @@ HelpMsg (VOID)
         "-only <n> \n"
         "        Only run tests for rules at level <n> \n"
         "-p2p    Pass this flag to indicate that PCIe Hierarchy Supports Peer-to-Peer\n"
+        "-profile <summary|json|csv>\n"
+        "        Print per-rule and per-module timings after the run\n"
         "-r      Run tests for passed comma-separated Rule IDs or a rules file\n"
         "        Examples: -r B_PE_01,B_PE_02,B_GIC_01\n"
         "                  -r rules.txt  (file may mix commas/newlines; lines \n"
@@ -113,3 +113,8 @@
 #ifndef PLAT_FIRME_GPT_GRANULE_SIZE
 #define PLAT_FIRME_GPT_GRANULE_SIZE 0x1000ULL
 #endif
+
+/* Number of contiguous GPT granules in the test window. */
+#ifndef PLAT_FIRME_GPT_GRANULE_COUNT
+#define PLAT_FIRME_GPT_GRANULE_COUNT 16ULL
+#endif
@@ -7,6 +7,7 @@
 
 #include "val_firme_gpt.h"
 #include "val_firme_rules.h"
+#include "val_firme_suite.h"
 #include "val_log.h"
 
 /* Fail-step bases for cross-world enforcement matrix checks. */
@@ -37,7 +38,8 @@ int firme_gpt_transition_feat_gdi_run_ns(uint64_t base_pa, firme_rule_res_t *out
     firme_res_t res = (firme_res_t){0};
     val_fault_info_t fault_info = (val_fault_info_t){0};
     const uint64_t test_data = FIRME_TEST_DATA_PATTERN;
-    const uint64_t granule_count = 1ULL;
+    const uint64_t granule_count = val_firme_gpt_granule_count();
+    const uint64_t granule_size = val_firme_gpt_granule_size();
     const uint64_t expected_done = granule_count;
     const uint32_t check_value = 1U;
     const uint64_t clear_value = 0ULL;
@@ -59,8 +61,9 @@ int firme_gpt_transition_feat_gdi_run_ns(uint64_t base_pa, firme_rule_res_t *out
     gdi = val_firme_feat_rme_gdi_present();
     gpc2 = val_firme_feat_rme_gpc2_present();
 
-    /* Step 1: seed the test granule from NS. */
-    if (val_probe_write64(base_pa, test_data, &fault_info) != 0) {
+    /* Step 1: seed every granule of the test window from NS. */
+    if (val_firme_ns_probe_write64_range(base_pa, granule_size, granule_count,
+                                         test_data, &fault_info) != 0) {
         LOG_ERROR(NULL, "%s: baseline write fault esr=%llx far=%llx",
                   GPT_TRANS_FEAT_GDI_TEST_NAME,
                   (unsigned long long)fault_info.esr, (unsigned long long)fault_info.far);
@@ -73,8 +76,9 @@ int firme_gpt_transition_feat_gdi_run_ns(uint64_t base_pa, firme_rule_res_t *out
     }
 
     /* Step 2: validate baseline enforcement for Non-secure GPI. */
-    if (!val_firme_check_access_matrix(base_pa, FIRME_GPI_NONSECURE, test_data, check_value, out,
-                                       GPT_TRANS_FEAT_GDI_MATRIX_BASELINE_STEP_BASE)) {
+    if (!val_firme_check_access_matrix_range(base_pa, granule_size, granule_count,
+                                             FIRME_GPI_NONSECURE, test_data, check_value, out,
+                                             GPT_TRANS_FEAT_GDI_MATRIX_BASELINE_STEP_BASE)) {
         if (out) {
             LOG_ERROR(NULL,
                       "%s: baseline matrix failed step=%llu x0=%llx x1=%llx",
@@ -134,8 +138,9 @@ int firme_gpt_transition_feat_gdi_run_ns(uint64_t base_pa, firme_rule_res_t *out
         goto cleanup;
     }
 
-    if (!val_firme_check_access_matrix(base_pa, FIRME_GPI_NSP, test_data, check_value, out,
-                                       GPT_TRANS_FEAT_GDI_MATRIX_NSP_STEP_BASE)) {
+    if (!val_firme_check_access_matrix_range(base_pa, granule_size, granule_count,
+                                             FIRME_GPI_NSP, test_data, check_value, out,
+                                             GPT_TRANS_FEAT_GDI_MATRIX_NSP_STEP_BASE)) {
         if (out) {
             LOG_ERROR(NULL,
                       "%s: NSP matrix failed step=%llu x0=%llx x1=%llx",
@@ -160,8 +165,9 @@ int firme_gpt_transition_feat_gdi_run_ns(uint64_t base_pa, firme_rule_res_t *out
         goto cleanup;
     }
 
-    if (!val_firme_check_access_matrix(base_pa, FIRME_GPI_NONSECURE, test_data, check_value, out,
-                                       GPT_TRANS_FEAT_GDI_MATRIX_RESTORE_AFTER_NSP_STEP)) {
+    if (!val_firme_check_access_matrix_range(base_pa, granule_size, granule_count,
+                                             FIRME_GPI_NONSECURE, test_data, check_value, out,
+                                             GPT_TRANS_FEAT_GDI_MATRIX_RESTORE_AFTER_NSP_STEP)) {
         if (out) {
             LOG_ERROR(NULL,
                       "%s: NS restore matrix failed step=%llu x0=%llx x1=%llx",
@@ -187,8 +193,9 @@ int firme_gpt_transition_feat_gdi_run_ns(uint64_t base_pa, firme_rule_res_t *out
         goto cleanup;
     }
 
-    if (!val_firme_check_access_matrix(base_pa, FIRME_GPI_SA, test_data, check_value, out,
-                                       GPT_TRANS_FEAT_GDI_MATRIX_SA_STEP_BASE)) {
+    if (!val_firme_check_access_matrix_range(base_pa, granule_size, granule_count,
+                                             FIRME_GPI_SA, test_data, check_value, out,
+                                             GPT_TRANS_FEAT_GDI_MATRIX_SA_STEP_BASE)) {
         if (out) {
             LOG_ERROR(NULL,
                       "%s: SA matrix failed step=%llu x0=%llx x1=%llx",
@@ -213,8 +220,9 @@ int firme_gpt_transition_feat_gdi_run_ns(uint64_t base_pa, firme_rule_res_t *out
         goto cleanup;
     }
 
-    if (!val_firme_check_access_matrix(base_pa, FIRME_GPI_NONSECURE, test_data, check_value, out,
-                                       GPT_TRANS_FEAT_GDI_MATRIX_RESTORE_AFTER_SA_STEP)) {
+    if (!val_firme_check_access_matrix_range(base_pa, granule_size, granule_count,
+                                             FIRME_GPI_NONSECURE, test_data, check_value, out,
+                                             GPT_TRANS_FEAT_GDI_MATRIX_RESTORE_AFTER_SA_STEP)) {
         if (out) {
             LOG_ERROR(NULL,
                       "%s: NS restore matrix failed step=%llu x0=%llx x1=%llx",
@@ -234,8 +242,9 @@ int firme_gpt_transition_feat_gdi_run_ns(uint64_t base_pa, firme_rule_res_t *out
          */
         val_firme_gm_gpi_set_do_retry(base_pa, granule_count, FIRME_GPI_NSO, &res);
         if (val_firme_status_success(res.x0, res.x1, expected_done)) {
-            if (!val_firme_check_access_matrix(base_pa, FIRME_GPI_NSO, test_data, check_value, out,
-                                               GPT_TRANS_FEAT_GDI_MATRIX_NSO_STEP_BASE)) {
+            if (!val_firme_check_access_matrix_range(base_pa, granule_size, granule_count,
+                                                     FIRME_GPI_NSO, test_data, check_value, out,
+                                                     GPT_TRANS_FEAT_GDI_MATRIX_NSO_STEP_BASE)) {
                 if (out) {
                     LOG_ERROR(NULL,
                               "%s: NSO matrix failed step=%llu x0=%llx x1=%llx",
@@ -260,8 +269,9 @@ int firme_gpt_transition_feat_gdi_run_ns(uint64_t base_pa, firme_rule_res_t *out
                 goto cleanup;
             }
 
-            if (!val_firme_check_access_matrix(base_pa, FIRME_GPI_NSP, test_data, check_value, out,
-                                               GPT_TRANS_FEAT_GDI_MATRIX_NSP_FROM_NSO_STEP_BASE)) {
+            if (!val_firme_check_access_matrix_range(
+                    base_pa, granule_size, granule_count, FIRME_GPI_NSP, test_data,
+                    check_value, out, GPT_TRANS_FEAT_GDI_MATRIX_NSP_FROM_NSO_STEP_BASE)) {
                 if (out) {
                     LOG_ERROR(NULL,
                               "%s: NSP matrix failed step=%llu x0=%llx x1=%llx",
@@ -286,8 +296,9 @@ int firme_gpt_transition_feat_gdi_run_ns(uint64_t base_pa, firme_rule_res_t *out
                 goto cleanup;
             }
 
-            if (!val_firme_check_access_matrix(base_pa, FIRME_GPI_NSO, test_data, check_value, out,
-                                               GPT_TRANS_FEAT_GDI_MATRIX_NSO_RESTORE_STEP_BASE)) {
+            if (!val_firme_check_access_matrix_range(
+                    base_pa, granule_size, granule_count, FIRME_GPI_NSO, test_data,
+                    check_value, out, GPT_TRANS_FEAT_GDI_MATRIX_NSO_RESTORE_STEP_BASE)) {
                 if (out) {
                     LOG_ERROR(NULL,
                               "%s: NSO matrix failed step=%llu x0=%llx x1=%llx",
@@ -312,8 +323,9 @@ int firme_gpt_transition_feat_gdi_run_ns(uint64_t base_pa, firme_rule_res_t *out
                 goto cleanup;
             }
 
-            if (!val_firme_check_access_matrix(base_pa, FIRME_GPI_SA, test_data, check_value, out,
-                                               GPT_TRANS_FEAT_GDI_MATRIX_SA_FROM_NSO_STEP_BASE)) {
+            if (!val_firme_check_access_matrix_range(
+                    base_pa, granule_size, granule_count, FIRME_GPI_SA, test_data,
+                    check_value, out, GPT_TRANS_FEAT_GDI_MATRIX_SA_FROM_NSO_STEP_BASE)) {
                 if (out) {
                     LOG_ERROR(NULL,
                               "%s: SA matrix failed step=%llu x0=%llx x1=%llx",
@@ -338,8 +350,9 @@ int firme_gpt_transition_feat_gdi_run_ns(uint64_t base_pa, firme_rule_res_t *out
                 goto cleanup;
             }
 
-            if (!val_firme_check_access_matrix(base_pa, FIRME_GPI_NSO, test_data, check_value, out,
-                                               GPT_TRANS_FEAT_GDI_MATRIX_NSO_FROM_SA_STEP_BASE)) {
+            if (!val_firme_check_access_matrix_range(
+                    base_pa, granule_size, granule_count, FIRME_GPI_NSO, test_data,
+                    check_value, out, GPT_TRANS_FEAT_GDI_MATRIX_NSO_FROM_SA_STEP_BASE)) {
                 if (out) {
                     LOG_ERROR(NULL,
                               "%s: NSO matrix failed step=%llu x0=%llx x1=%llx",
@@ -360,6 +373,7 @@ int firme_gpt_transition_feat_gdi_run_ns(uint64_t base_pa, firme_rule_res_t *out
 cleanup:
     /* Best-effort cleanup: restore to NS and clear test data. */
     val_firme_gm_gpi_set_do_retry(base_pa, granule_count, FIRME_GPI_NONSECURE, &res);
-    val_probe_write64(base_pa, clear_value, &fault_info);
+    (void)val_firme_ns_probe_write64_range(base_pa, granule_size, granule_count,
+                                           clear_value, &fault_info);
     return 0;
 }
@@ -7,6 +7,7 @@
 
 #include "val_firme_gpt.h"
 #include "val_firme_rules.h"
+#include "val_firme_suite.h"
 #include "val_log.h"
 
 /* Fail-step bases for cross-world enforcement matrix checks. */
@@ -28,7 +29,8 @@ int firme_gpt_transition_feat_gpc2_run_ns(uint64_t base_pa, firme_rule_res_t *ou
     firme_res_t res = (firme_res_t){0};
     val_fault_info_t fault_info = (val_fault_info_t){0};
     const uint64_t test_data = FIRME_TEST_DATA_PATTERN;
-    const uint64_t granule_count = 1ULL;
+    const uint64_t granule_count = val_firme_gpt_granule_count();
+    const uint64_t granule_size = val_firme_gpt_granule_size();
     const uint64_t expected_done = granule_count;
     const uint32_t check_value = 1U;
     const uint64_t clear_value = 0ULL;
@@ -48,8 +50,9 @@ int firme_gpt_transition_feat_gpc2_run_ns(uint64_t base_pa, firme_rule_res_t *ou
 
     gpc2 = val_firme_feat_rme_gpc2_present();
 
-    /* Step 1: seed the test granule from NS. */
-    if (val_probe_write64(base_pa, test_data, &fault_info) != 0) {
+    /* Step 1: seed every granule of the test window from NS. */
+    if (val_firme_ns_probe_write64_range(base_pa, granule_size, granule_count,
+                                         test_data, &fault_info) != 0) {
         LOG_ERROR(NULL, "%s: baseline write fault esr=%llx far=%llx",
                   GPT_TRANS_FEAT_GPC2_TEST_NAME,
                   (unsigned long long)fault_info.esr, (unsigned long long)fault_info.far);
@@ -62,8 +65,9 @@ int firme_gpt_transition_feat_gpc2_run_ns(uint64_t base_pa, firme_rule_res_t *ou
     }
 
     /* Step 2: validate baseline enforcement for Non-secure GPI. */
-    if (!val_firme_check_access_matrix(base_pa, FIRME_GPI_NONSECURE, test_data, check_value, out,
-                                       GPT_TRANS_FEAT_GPC2_MATRIX_BASELINE_STEP_BASE)) {
+    if (!val_firme_check_access_matrix_range(base_pa, granule_size, granule_count,
+                                             FIRME_GPI_NONSECURE, test_data, check_value, out,
+                                             GPT_TRANS_FEAT_GPC2_MATRIX_BASELINE_STEP_BASE)) {
         if (out) {
             LOG_ERROR(NULL, "%s: baseline matrix failed step=%llu x0=%llx x1=%llx",
                       GPT_TRANS_FEAT_GPC2_TEST_NAME,
@@ -89,8 +93,9 @@ int firme_gpt_transition_feat_gpc2_run_ns(uint64_t base_pa, firme_rule_res_t *ou
             goto cleanup;
         }
 
-        if (!val_firme_check_access_matrix(base_pa, FIRME_GPI_NSO, test_data, check_value, out,
-                                           GPT_TRANS_FEAT_GPC2_MATRIX_NSO_STEP_BASE)) {
+        if (!val_firme_check_access_matrix_range(base_pa, granule_size, granule_count,
+                                                 FIRME_GPI_NSO, test_data, check_value, out,
+                                                 GPT_TRANS_FEAT_GPC2_MATRIX_NSO_STEP_BASE)) {
             if (out) {
                 LOG_ERROR(NULL, "%s: NSO matrix failed step=%llu x0=%llx x1=%llx",
                           GPT_TRANS_FEAT_GPC2_TEST_NAME,
@@ -115,9 +120,9 @@ int firme_gpt_transition_feat_gpc2_run_ns(uint64_t base_pa, firme_rule_res_t *ou
             goto cleanup;
         }
 
-        if (!val_firme_check_access_matrix(base_pa, FIRME_GPI_NONSECURE,
-                                           test_data, check_value, out,
-                                           GPT_TRANS_FEAT_GPC2_MATRIX_RESTORE_STEP_BASE)) {
+        if (!val_firme_check_access_matrix_range(base_pa, granule_size, granule_count,
+                                                 FIRME_GPI_NONSECURE, test_data, check_value, out,
+                                                 GPT_TRANS_FEAT_GPC2_MATRIX_RESTORE_STEP_BASE)) {
             if (out) {
                 LOG_ERROR(NULL,
                           "%s: NS restore matrix failed step=%llu x0=%llx x1=%llx",
@@ -148,6 +153,7 @@ int firme_gpt_transition_feat_gpc2_run_ns(uint64_t base_pa, firme_rule_res_t *ou
 cleanup:
     /* Best-effort cleanup: restore to NS and clear test data. */
     val_firme_gm_gpi_set_do_retry(base_pa, granule_count, FIRME_GPI_NONSECURE, &res);
-    val_probe_write64(base_pa, clear_value, &fault_info);
+    (void)val_firme_ns_probe_write64_range(base_pa, granule_size, granule_count,
+                                           clear_value, &fault_info);
     return 0;
 }
@@ -7,6 +7,7 @@
 
 #include "val_firme_gpt.h"
 #include "val_firme_rules.h"
+#include "val_firme_suite.h"
 #include "val_log.h"
 
 #define GPT_TRANS_FEAT_RME_FAILSTEP_PROBE_WRITE UINT64_C(20)
@@ -24,7 +25,7 @@
 int firme_gpt_transition_feat_rme_run_secure(uint64_t base_pa, firme_rule_res_t *out)
 {
     firme_res_t res = (firme_res_t){0};
-    const uint64_t granule_count = 1ULL;
+    const uint64_t granule_count = val_firme_gpt_granule_count();
     const uint64_t expected_done = granule_count;
 
     if (out) {
@@ -164,7 +165,7 @@ int firme_gpt_transition_feat_rme_run_secure(uint64_t base_pa, firme_rule_res_t
 int firme_gpt_transition_feat_rme_run_realm(uint64_t base_pa, firme_rule_res_t *out)
 {
     firme_res_t res = (firme_res_t){0};
-    const uint64_t granule_count = 1ULL;
+    const uint64_t granule_count = val_firme_gpt_granule_count();
     const uint64_t expected_done = granule_count;
 
     if (out) {
@@ -292,7 +293,8 @@ int firme_gpt_transition_feat_rme_run_ns(uint64_t base_pa, firme_rule_res_t *out
     firme_res_t res = (firme_res_t){0};
     val_fault_info_t fault_info = (val_fault_info_t){0};
     const uint64_t test_data = FIRME_TEST_DATA_PATTERN;
-    const uint64_t granule_count = 1ULL;
+    const uint64_t granule_count = val_firme_gpt_granule_count();
+    const uint64_t granule_size = val_firme_gpt_granule_size();
     const uint32_t check_value = 1U;
     const uint64_t matrix_step_base = UINT64_C(0);
     const uint64_t clear_value = 0ULL;
@@ -313,8 +315,9 @@ int firme_gpt_transition_feat_rme_run_ns(uint64_t base_pa, firme_rule_res_t *out
     gpc2 = val_firme_feat_rme_gpc2_present();
     gdi = val_firme_feat_rme_gdi_present();
 
-    /* Step 1: seed the test granule from NS. */
-    if (val_probe_write64(base_pa, test_data, &fault_info) != 0) {
+    /* Step 1: seed every granule of the test window from NS. */
+    if (val_firme_ns_probe_write64_range(base_pa, granule_size, granule_count,
+                                         test_data, &fault_info) != 0) {
         LOG_ERROR(NULL, "%s: ns baseline write fault esr=%llx far=%llx",
                   GPT_TRANS_FEAT_RME_TEST_NAME,
                   (unsigned long long)fault_info.esr,
@@ -328,8 +331,9 @@ int firme_gpt_transition_feat_rme_run_ns(uint64_t base_pa, firme_rule_res_t *out
     }
 
     /* Step 2: validate baseline enforcement for Non-secure GPI. */
-    if (!val_firme_check_access_matrix(base_pa, FIRME_GPI_NONSECURE, test_data, check_value,
-                                       out, matrix_step_base)) {
+    if (!val_firme_check_access_matrix_range(base_pa, granule_size, granule_count,
+                                             FIRME_GPI_NONSECURE, test_data, check_value, out,
+                                             matrix_step_base)) {
         if (out) {
             LOG_ERROR(NULL, "%s: ns baseline matrix failed step=%llu x0=%llx x1=%llx",
                       GPT_TRANS_FEAT_RME_TEST_NAME,
@@ -429,6 +433,7 @@ cleanup:
      *   even if cleanup isn't possible on a broken implementation.
      */
     val_firme_gm_gpi_set_do_retry(base_pa, granule_count, FIRME_GPI_NONSECURE, &res);
-    val_probe_write64(base_pa, clear_value, &fault_info);
+    (void)val_firme_ns_probe_write64_range(base_pa, granule_size, granule_count,
+                                           clear_value, &fault_info);
     return 0;
 }
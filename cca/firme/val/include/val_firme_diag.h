@@ -25,11 +25,54 @@ typedef struct {
  * - test 0: ignores a0..a2
  * - test 1: a0 = feature register index
  * - test 2: a0 = address to probe (64-bit load)
+ * - test 3: batched probe, a0 = first address, a1 = FIRME_DIAG_BATCH_* encoding,
+ *           a2 = expected value (see val_firme_diag_probe_batch)
  *
  * Return value uses ACS-style status codes:
  *   ACS_STATUS_PASS = handled
  *   ACS_STATUS_SKIP = skipped by convention (e.g. missing platform window)
  *   ACS_STATUS_ERR  = unknown test id / internal error
  */
+/* Diagnostic test selectors. */
+#define FIRME_DIAG_TEST_VERSION      0U
+#define FIRME_DIAG_TEST_FEATURES     1U
+#define FIRME_DIAG_TEST_PROBE_READ   2U
+#define FIRME_DIAG_TEST_PROBE_BATCH  3U
+
+/*
+ * Batched probe descriptor (test 3, a1):
+ * - [15:0]  number of addresses to probe (1..FIRME_DIAG_BATCH_MAX_COUNT)
+ * - [47:16] stride in bytes between consecutive addresses
+ * - [62]    accesses are expected to take a GPF
+ * - [63]    compare the value read with the expected value
+ */
+#define FIRME_DIAG_BATCH_COUNT_MASK     UINT64_C(0xFFFF)
+#define FIRME_DIAG_BATCH_STRIDE_SHIFT   16U
+#define FIRME_DIAG_BATCH_STRIDE_MASK    UINT64_C(0xFFFFFFFF)
+#define FIRME_DIAG_BATCH_EXPECT_FAULT   (UINT64_C(1) << 62)
+#define FIRME_DIAG_BATCH_CHECK_VALUE    (UINT64_C(1) << 63)
+#define FIRME_DIAG_BATCH_MAX_COUNT      FIRME_DIAG_BATCH_COUNT_MASK
+
+#define FIRME_DIAG_BATCH_DESC(count, stride, flags) \
+    (((uint64_t)(count) & FIRME_DIAG_BATCH_COUNT_MASK) | \
+     (((uint64_t)(stride) & FIRME_DIAG_BATCH_STRIDE_MASK) << FIRME_DIAG_BATCH_STRIDE_SHIFT) | \
+     (uint64_t)(flags))
+
+/* Batched probe outcome (test 3, out->x1). */
+#define FIRME_DIAG_BATCH_OK                0U
+#define FIRME_DIAG_BATCH_UNEXPECTED_FAULT  1U  /* x2 = esr,   x3 = far      */
+#define FIRME_DIAG_BATCH_VALUE_MISMATCH    2U  /* x2 = value, x3 = expected */
+#define FIRME_DIAG_BATCH_MISSING_FAULT     3U  /* x2 = value, x3 = 0        */
+#define FIRME_DIAG_BATCH_NOT_GPF           4U  /* x2 = esr,   x3 = far      */
+
+/*
+ * Probe every address of a batch from the current world and stop at the first
+ * access which does not match the expectation.
+ * out->x0 = index of the first mismatching probe (count when all matched),
+ * out->x1 = FIRME_DIAG_BATCH_* outcome, out->x2/x3 = outcome details.
+ */
+void val_firme_diag_probe_batch(uint64_t addr, uint64_t desc, uint64_t expected_value,
+                                firme_diag_out_t *out);
+
 int val_firme_diag_run(uint64_t test_id, uint64_t a0, uint64_t a1, uint64_t a2, uint64_t a3,
                        firme_diag_out_t *out);
@@ -11,6 +11,7 @@
 
 #include "val_firme_abi.h"
 #include "val_firme_dispatch.h"
+#include "val_firme_diag.h"
 #include "val_common/val_fault.h"
 #include "val_firme_rules.h"
 #include "val_firme_test.h"
@@ -33,7 +34,19 @@ int val_firme_mem_read64_world(firme_acs_world_t world,
                                uint64_t *out_value,
                                val_fault_info_t *out_fault);
 
+/* Probe a batch of addresses from one world with a single world switch (diag test 3). */
+int val_firme_mem_probe_batch_world(firme_acs_world_t world,
+                                    uint64_t addr,
+                                    uint64_t desc,
+                                    uint64_t expected_value,
+                                    firme_diag_out_t *out);
+
 void val_firme_ns_write64(uint64_t addr, uint64_t value);
+int val_firme_ns_probe_write64_range(uint64_t addr,
+                                     uint64_t stride,
+                                     uint64_t count,
+                                     uint64_t value,
+                                     val_fault_info_t *out_fault);
 
 /* Status helpers (FIRME returns are signed, but often transported as unsigned). */
 int64_t val_firme_as_i64(uint64_t v);
@@ -50,3 +63,12 @@ uint32_t val_firme_check_access_matrix(uint64_t addr,
                                        uint32_t check_value,
                                        firme_rule_res_t *out,
                                        uint64_t fail_step_base);
+
+uint32_t val_firme_check_access_matrix_range(uint64_t addr,
+                                             uint64_t stride,
+                                             uint64_t count,
+                                             uint64_t gpi,
+                                             uint64_t expected_value,
+                                             uint32_t check_value,
+                                             firme_rule_res_t *out,
+                                             uint64_t fail_step_base);
@@ -87,3 +87,15 @@ const char *val_firme_chapter_str(firme_chapter_id_t chapter);
  *   @return   - Platform base PA for GPT tests (0 if not configured).
 **/
 uint64_t val_firme_gpt_base_for_world(firme_acs_world_t world);
+
+/**
+ *   @brief    - Return the GPT granule size used to step through the test window.
+ *   @return   - Platform GPT granule size in bytes.
+**/
+uint64_t val_firme_gpt_granule_size(void);
+
+/**
+ *   @brief    - Return the number of contiguous GPT granules in the test window.
+ *   @return   - Platform GPT test window length in granules.
+**/
+uint64_t val_firme_gpt_granule_count(void);
@@ -10,6 +10,65 @@
 #include "val_firme_abi.h"
 #include "val_common/val_fault.h"
 
+/**
+ *   @brief    - Probe a batch of addresses and check each access against an expectation.
+ *   @param    - addr           : First address to probe.
+ *   @param    - desc           : FIRME_DIAG_BATCH_DESC() encoded count/stride/flags.
+ *   @param    - expected_value : Expected 64-bit value when FIRME_DIAG_BATCH_CHECK_VALUE.
+ *   @param    - out            : Batch outcome (see val_firme_diag.h).
+ *   @return   - void
+**/
+void val_firme_diag_probe_batch(uint64_t addr, uint64_t desc, uint64_t expected_value,
+                                firme_diag_out_t *out)
+{
+    const uint64_t count = desc & FIRME_DIAG_BATCH_COUNT_MASK;
+    const uint64_t stride = (desc >> FIRME_DIAG_BATCH_STRIDE_SHIFT) &
+                            FIRME_DIAG_BATCH_STRIDE_MASK;
+    const uint32_t expect_fault = (uint32_t)((desc & FIRME_DIAG_BATCH_EXPECT_FAULT) != 0ULL);
+    const uint32_t check_value = (uint32_t)((desc & FIRME_DIAG_BATCH_CHECK_VALUE) != 0ULL);
+    uint64_t i = 0;
+
+    out->x0 = 0;
+    out->x1 = FIRME_DIAG_BATCH_OK;
+    out->x2 = 0;
+    out->x3 = 0;
+
+    for (i = 0; i < count; i++) {
+        val_fault_info_t fi = {0};
+        uint64_t v = 0;
+        int rc = val_probe_read64(addr + (i * stride), &v, &fi);
+
+        if (expect_fault == 0U) {
+            if (rc != 0) {
+                out->x1 = FIRME_DIAG_BATCH_UNEXPECTED_FAULT;
+                out->x2 = fi.esr;
+                out->x3 = fi.far;
+                break;
+            }
+            if (check_value != 0U && v != expected_value) {
+                out->x1 = FIRME_DIAG_BATCH_VALUE_MISMATCH;
+                out->x2 = v;
+                out->x3 = expected_value;
+                break;
+            }
+        } else {
+            if (rc == 0) {
+                out->x1 = FIRME_DIAG_BATCH_MISSING_FAULT;
+                out->x2 = v;
+                break;
+            }
+            if (!val_fault_is_gpf(fi.esr)) {
+                out->x1 = FIRME_DIAG_BATCH_NOT_GPF;
+                out->x2 = fi.esr;
+                out->x3 = fi.far;
+                break;
+            }
+        }
+    }
+
+    out->x0 = i;
+}
+
 /**
  *   @brief    - Run a small diagnostic test inside the current world payload.
  *   @param    - test_id : Test selector.
@@ -79,5 +138,20 @@ int val_firme_diag_run(uint64_t test_id, uint64_t a0, uint64_t a1, uint64_t a2,
         return (int)ACS_STATUS_PASS;
     }
 
+    if (test_id == FIRME_DIAG_TEST_PROBE_BATCH) {
+        firme_diag_out_t batch = {0};
+
+        (void)a3;
+
+        val_firme_diag_probe_batch(a0, a1, a2, &batch);
+        if (out) {
+            out->x0 = batch.x0;
+            out->x1 = batch.x1;
+            out->x2 = batch.x2;
+            out->x3 = batch.x3;
+        }
+        return (int)ACS_STATUS_PASS;
+    }
+
     return (int)ACS_STATUS_ERR;
 }
@@ -7,6 +7,8 @@
 
 #include "val_firme_gpt.h"
 
+#include "val_firme_diag.h"
+
 #include "aarch64/sysreg.h"
 #include "val_common/val_status.h"
 #include "val_log.h"
@@ -42,7 +44,7 @@ int val_firme_mem_read64_world(firme_acs_world_t world,
     }
 
     if (val_firme_world_call(world, FIRME_ACS_CMD_RUN_DIAG,
-                            /* test_id */ 2,
+                            /* test_id */ FIRME_DIAG_TEST_PROBE_READ,
                             /* a0 */ addr,
                             /* a1 */ 0,
                             /* a2 */ 0,
@@ -81,6 +83,32 @@ void val_firme_ns_write64(uint64_t addr, uint64_t value)
     dsb_sy();
 }
 
+/**
+ *   @brief    - Store a value from NS at each of count addresses, stopping at the first fault.
+ *   @param    - addr      : First address to write.
+ *   @param    - stride    : Distance in bytes between written addresses.
+ *   @param    - count     : Number of addresses to write.
+ *   @param    - value     : Value to store.
+ *   @param    - out_fault : Optional fault info of the faulting write.
+ *   @return   - 0 if all writes completed, non-zero if one faulted.
+**/
+int val_firme_ns_probe_write64_range(uint64_t addr,
+                                     uint64_t stride,
+                                     uint64_t count,
+                                     uint64_t value,
+                                     val_fault_info_t *out_fault)
+{
+    for (uint64_t i = 0; i < count; i++) {
+        int ret = val_probe_write64(addr + (i * stride), value, out_fault);
+
+        if (ret != 0) {
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
 /**
  *   @brief    - Convert an ABI return value into a signed status.
  *   @param    - v : Raw x0 return (often transported as zero-extended SMC32).
@@ -162,21 +190,68 @@ uint32_t val_firme_expect_access_world(uint64_t gpi, firme_acs_world_t world)
 }
 
 /**
- *   @brief    - Validate access enforcement from all worlds for a single address/GPI.
- *   @param    - addr           : Address to probe.
- *   @param    - gpi            : GPI the granule is expected to be in.
+ *   @brief    - Probe a batch of addresses from a given world with a single world switch.
+ *   @param    - world          : Target world (NS-EL2/Secure/Realm).
+ *   @param    - addr           : First address to probe.
+ *   @param    - desc           : FIRME_DIAG_BATCH_DESC() encoded count/stride/flags.
+ *   @param    - expected_value : Expected value when FIRME_DIAG_BATCH_CHECK_VALUE is set.
+ *   @param    - out            : Batch outcome (x0=index, x1=outcome, x2/x3=details).
+ *   @return   - VAL_SUCCESS on dispatch, VAL_ERROR on transport failure.
+**/
+int val_firme_mem_probe_batch_world(firme_acs_world_t world,
+                                    uint64_t addr,
+                                    uint64_t desc,
+                                    uint64_t expected_value,
+                                    firme_diag_out_t *out)
+{
+    firme_acs_call_res_t res = {0};
+
+    if (world == FIRME_ACS_WORLD_NSEL2) {
+        val_firme_diag_probe_batch(addr, desc, expected_value, out);
+        return VAL_SUCCESS;
+    }
+
+    if (val_firme_world_call(world, FIRME_ACS_CMD_RUN_DIAG,
+                            /* test_id */ FIRME_DIAG_TEST_PROBE_BATCH,
+                            /* a0 */ addr,
+                            /* a1 */ desc,
+                            /* a2 */ expected_value,
+                            &res) != 0) {
+        return VAL_ERROR;
+    }
+    if (res.x0 != (uint64_t)ACS_STATUS_PASS) {
+        return VAL_ERROR;
+    }
+
+    out->x0 = res.x1; /* index of the first mismatch */
+    out->x1 = res.x2; /* FIRME_DIAG_BATCH_* outcome */
+    out->x2 = res.x3;
+    out->x3 = res.x4;
+    return VAL_SUCCESS;
+}
+
+/**
+ *   @brief    - Validate access enforcement from all worlds for a range of granules/GPI.
+ *               Each world probes the whole range in one batch, so the check costs
+ *               one Secure and one Realm world switch regardless of the count.
+ *   @param    - addr           : First address to probe.
+ *   @param    - stride         : Distance in bytes between probed addresses.
+ *   @param    - count          : Number of addresses (1..FIRME_DIAG_BATCH_MAX_COUNT).
+ *   @param    - gpi            : GPI all probed granules are expected to be in.
  *   @param    - expected_value : Expected 64-bit value when access is permitted.
  *   @param    - check_value    : If non-zero, validate the returned value as well.
  *   @param    - out            : Optional rule result (filled on failure).
  *   @param    - fail_step_base : Base step index to encode which world failed.
  *   @return   - 1 if matrix matches expectations, 0 otherwise.
 **/
-uint32_t val_firme_check_access_matrix(uint64_t addr,
-                                       uint64_t gpi,
-                                       uint64_t expected_value,
-                                       uint32_t check_value,
-                                       firme_rule_res_t *out,
-                                       uint64_t fail_step_base)
+uint32_t val_firme_check_access_matrix_range(uint64_t addr,
+                                             uint64_t stride,
+                                             uint64_t count,
+                                             uint64_t gpi,
+                                             uint64_t expected_value,
+                                             uint32_t check_value,
+                                             firme_rule_res_t *out,
+                                             uint64_t fail_step_base)
 {
     /* Transport failure tag for out->last_x0. */
     const uint64_t transport_fail_magic = UINT64_C(0xFFFF0000);
@@ -187,13 +262,31 @@ uint32_t val_firme_check_access_matrix(uint64_t addr,
         FIRME_ACS_WORLD_REALM,
     };
 
+    if (count == 0ULL || count > FIRME_DIAG_BATCH_MAX_COUNT) {
+        if (out) {
+            out->fail_step = fail_step_base;
+            out->last_x0 = transport_fail_magic;
+            out->last_x1 = count;
+        }
+        return 0U;
+    }
+
     for (uint32_t i = 0; i < 3U; i++) {
         const firme_acs_world_t world = worlds[i];
-        val_fault_info_t fault_info = {0};
-        uint64_t value = 0;
-        uint32_t expected_ok = 0;
+        firme_diag_out_t batch = {0};
+        uint64_t flags = 0;
 
-        if (val_firme_mem_read64_world(world, addr, &value, &fault_info) != VAL_SUCCESS) {
+        if (val_firme_expect_access_world(gpi, world) != 0U) {
+            if (check_value != 0U) {
+                flags = FIRME_DIAG_BATCH_CHECK_VALUE;
+            }
+        } else {
+            flags = FIRME_DIAG_BATCH_EXPECT_FAULT;
+        }
+
+        if (val_firme_mem_probe_batch_world(world, addr,
+                                            FIRME_DIAG_BATCH_DESC(count, stride, flags),
+                                            expected_value, &batch) != VAL_SUCCESS) {
             if (out) {
                 out->fail_step = fail_step_base + (uint64_t)i;
                 out->last_x0 = transport_fail_magic | (uint64_t)i;
@@ -202,43 +295,43 @@ uint32_t val_firme_check_access_matrix(uint64_t addr,
             return 0U;
         }
 
-        expected_ok = val_firme_expect_access_world(gpi, world);
-        if (expected_ok != 0U) {
-            if (fault_info.faulted != 0U) {
-                if (out) {
-                    out->fail_step = fail_step_base + (uint64_t)i;
-                    out->last_x0 = fault_info.esr;
-                    out->last_x1 = fault_info.far;
-                }
-                return 0U;
-            }
-            if (check_value != 0U && value != expected_value) {
-                if (out) {
-                    out->fail_step = fail_step_base + (uint64_t)i;
-                    out->last_x0 = value;
-                    out->last_x1 = expected_value;
-                }
-                return 0U;
-            }
-        } else {
-            if (fault_info.faulted == 0U) {
-                if (out) {
-                    out->fail_step = fail_step_base + (uint64_t)i;
-                    out->last_x0 = value;
-                    out->last_x1 = 0;
-                }
-                return 0U;
+        if (batch.x1 != FIRME_DIAG_BATCH_OK) {
+            if (out) {
+                out->fail_step = fail_step_base + (uint64_t)i;
+                out->last_x0 = batch.x2;
+                out->last_x1 = batch.x3;
             }
-            if (!val_fault_is_gpf(fault_info.esr)) {
-                if (out) {
-                    out->fail_step = fail_step_base + (uint64_t)i;
-                    out->last_x0 = fault_info.esr;
-                    out->last_x1 = fault_info.far;
-                }
-                return 0U;
+            if (count > 1ULL) {
+                LOG_ERROR(NULL, "access matrix: world %u probe %llu of %llu failed (%llu)",
+                          (unsigned int)world,
+                          (unsigned long long)batch.x0,
+                          (unsigned long long)count,
+                          (unsigned long long)batch.x1);
             }
+            return 0U;
         }
     }
 
     return 1U;
 }
+
+/**
+ *   @brief    - Validate access enforcement from all worlds for a single address/GPI.
+ *   @param    - addr           : Address to probe.
+ *   @param    - gpi            : GPI the granule is expected to be in.
+ *   @param    - expected_value : Expected 64-bit value when access is permitted.
+ *   @param    - check_value    : If non-zero, validate the returned value as well.
+ *   @param    - out            : Optional rule result (filled on failure).
+ *   @param    - fail_step_base : Base step index to encode which world failed.
+ *   @return   - 1 if matrix matches expectations, 0 otherwise.
+**/
+uint32_t val_firme_check_access_matrix(uint64_t addr,
+                                       uint64_t gpi,
+                                       uint64_t expected_value,
+                                       uint32_t check_value,
+                                       firme_rule_res_t *out,
+                                       uint64_t fail_step_base)
+{
+    return val_firme_check_access_matrix_range(addr, 0ULL, 1ULL, gpi, expected_value,
+                                               check_value, out, fail_step_base);
+}
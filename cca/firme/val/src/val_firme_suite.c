@@ -136,3 +136,21 @@ uint64_t val_firme_gpt_base_for_world(firme_acs_world_t world)
         return (uint64_t)PLAT_FIRME_GPT_BASE_REALM;
     return (uint64_t)PLAT_FIRME_GPT_BASE_NS;
 }
+
+/**
+ *   @brief    - Return the GPT granule size used to step through the test window.
+ *   @return   - Platform GPT granule size in bytes.
+**/
+uint64_t val_firme_gpt_granule_size(void)
+{
+    return (uint64_t)PLAT_FIRME_GPT_GRANULE_SIZE;
+}
+
+/**
+ *   @brief    - Return the number of contiguous GPT granules in the test window.
+ *   @return   - Platform GPT test window length in granules.
+**/
+uint64_t val_firme_gpt_granule_count(void)
+{
+    return (uint64_t)PLAT_FIRME_GPT_GRANULE_COUNT;
+}
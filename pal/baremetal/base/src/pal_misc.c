@@ -384,6 +384,13 @@ pal_target_is_bm()
   return 1;
 }
 
+/* pal_memcpy and pal_mem_set operate on normal memory; the bulk of a buffer
+   is moved with aligned 64-bit accesses */
+typedef uint64_t __attribute__((__may_alias__)) pal_word_t;
+
+#define PAL_WORD_MASK   (sizeof(pal_word_t) - 1)
+#define PAL_WORD_BLOCK  (4 * sizeof(pal_word_t))
+
 /**
   Copies a source buffer to a destination buffer, and returns the destination buffer.
 
@@ -398,16 +405,50 @@ void *
 pal_memcpy(void *DestinationBuffer, const void *SourceBuffer, uint32_t Length)
 {
 
-    uint32_t i;
     const char *s = (char *)SourceBuffer;
     char *d = (char *) DestinationBuffer;
+    const pal_word_t *ws;
+    pal_word_t *wd;
+
+    /* Aligned 64-bit accesses when both buffers share 8-byte alignment */
+    if ((((uintptr_t)d ^ (uintptr_t)s) & PAL_WORD_MASK) == 0)
+    {
+        while (Length && ((uintptr_t)d & PAL_WORD_MASK))
+        {
+            *d++ = *s++;
+            Length--;
+        }
+
+        ws = (const pal_word_t *)s;
+        wd = (pal_word_t *)d;
+
+        while (Length >= PAL_WORD_BLOCK)
+        {
+            wd[0] = ws[0];
+            wd[1] = ws[1];
+            wd[2] = ws[2];
+            wd[3] = ws[3];
+            wd += 4;
+            ws += 4;
+            Length -= PAL_WORD_BLOCK;
+        }
+
+        while (Length >= sizeof(pal_word_t))
+        {
+            *wd++ = *ws++;
+            Length -= sizeof(pal_word_t);
+        }
 
-    for(i = 0; i < Length; i++)
+        s = (const char *)ws;
+        d = (char *)wd;
+    }
+
+    while (Length--)
     {
-        d[i] = s[i];
+        *d++ = *s++;
     }
 
-    return d;
+    return DestinationBuffer;
 }
 
 uint32_t pal_strncmp(const char8_t *str1, const char8_t *str2, uint32_t len)
@@ -454,7 +495,34 @@ void
 pal_mem_set(void *buf, uint32_t size, uint8_t value)
 {
     unsigned char *ptr = buf;
+    pal_word_t *wptr;
+    pal_word_t pattern = (pal_word_t)value * 0x0101010101010101ULL;
+
+    while (size && ((uintptr_t)ptr & PAL_WORD_MASK))
+    {
+        *ptr++ = (unsigned char)value;
+        size--;
+    }
+
+    wptr = (pal_word_t *)ptr;
+
+    while (size >= PAL_WORD_BLOCK)
+    {
+        wptr[0] = pattern;
+        wptr[1] = pattern;
+        wptr[2] = pattern;
+        wptr[3] = pattern;
+        wptr += 4;
+        size -= PAL_WORD_BLOCK;
+    }
+
+    while (size >= sizeof(pal_word_t))
+    {
+        *wptr++ = pattern;
+        size -= sizeof(pal_word_t);
+    }
 
+    ptr = (unsigned char *)wptr;
     while (size--)
     {
         *ptr++ = (unsigned char)value;
@@ -151,9 +151,28 @@ typedef enum {
     START_TXN_MONITOR    = 0xB,
     STOP_TXN_MONITOR     = 0xC,
     ATS_TXN_REQ          = 0xD,
-    INJECT_ERROR         = 0xE
+    INJECT_ERROR         = 0xE,
+    START_DMA_BATCH      = 0xF
 } EXERCISER_OPS;
 
+#define EXERCISER_DMA_PENDING   0xFFFFFFFF  /* Transfer not yet processed by the PAL */
+#define EXERCISER_DMA_NO_PASID  0xFFFFFFFF  /* Transfer is sent without a PASID TLP prefix */
+
+/* One transfer of a START_DMA_BATCH request */
+typedef struct {
+    uint64_t addr;       /* Bus address of the buffer in memory */
+    uint32_t len;        /* Transfer length in bytes */
+    uint32_t direction;  /* EDMA_TO_DEVICE or EDMA_FROM_DEVICE */
+    uint32_t pasid;      /* PASID of the transfer or EXERCISER_DMA_NO_PASID */
+    uint32_t status;     /* EXERCISER_DMA_PENDING, then 0 on success */
+} exerciser_dma_xfer_t;
+
+/* START_DMA_BATCH param: transfers are issued in array order */
+typedef struct {
+    uint32_t             count;
+    exerciser_dma_xfer_t *xfer;
+} exerciser_dma_batch_t;
+
 typedef enum {
     EXERCISER_RESET = 0x1,
     EXERCISER_ON    = 0x2,
@@ -94,6 +94,8 @@ static const acs_execution_policy_t g_platform_execution_policy = {
     .crypto_support = TRUE,
     .sys_last_lvl_cache = PLATFORM_OVERRRIDE_SLC,
     .el1skiptrap_mask = 0,
+    .profile_format = PLATFORM_OVERRIDE_PROFILE_FORMAT,
+    .deferred_log = PLATFORM_OVERRIDE_DEFERRED_LOG,
 };
 
 const acs_execution_policy_t *
@@ -787,6 +787,22 @@
 */
 #define PLATFORM_OVERRRIDE_SLC 0x0
 
+/* Rule timing profile report printed after the run
+   0 - None
+   1 - Summary of slowest rules and module totals
+   2 - JSON lines
+   3 - CSV
+*/
+#define PLATFORM_OVERRIDE_PROFILE_FORMAT 0x0
+
+/* Deferred logging. Every val_print message, including those below the print
+   level, is recorded in a binary buffer instead of being formatted, and the
+   buffer is dumped after the run for tools/scripts/acs_log_decode.py.
+   Messages at or above the print level are still printed as usual.
+   0 - Disabled, 1 - Enabled
+*/
+#define PLATFORM_OVERRIDE_DEFERRED_LOG 0x0
+
 /* Coresight components config parameters*/
 #define CS_COMPONENT_COUNT         0
 /* Placeholder - Coresight components config parameters
@@ -386,6 +386,64 @@ uint32_t pal_exerciser_start_dma_direction (uint64_t Base, EXERCISER_DMA_ATTR Di
 
 
 
+/**
+  @brief This function issues a list of DMA transfers back to back. The exerciser
+         DMA engine completes a transfer when it is triggered, so the list is
+         walked in order with the ECSR base and PASID capability looked up once.
+         PASID TLP prefixes are left disabled on return.
+**/
+static uint32_t pal_exerciser_dma_batch(uint64_t Base, uint64_t Ecam, uint32_t Bdf,
+                                        exerciser_dma_batch_t *Batch)
+{
+  uint32_t Index;
+  uint32_t Data;
+  uint32_t CapabilityOffset = 0;
+  uint64_t PasidCtrl = 0;
+  exerciser_dma_xfer_t *Xfer;
+
+  if ((Batch == NULL) || (Batch->xfer == NULL))
+      return 1;
+
+  for (Index = 0; Index < Batch->count; Index++) {
+      Xfer = &Batch->xfer[Index];
+
+      if ((Xfer->direction != EDMA_TO_DEVICE) && (Xfer->direction != EDMA_FROM_DEVICE)) {
+          Xfer->status = 1;
+          continue;
+      }
+
+      Data = pal_mmio_read(Base + DMACTL1);
+      if (Xfer->pasid != EXERCISER_DMA_NO_PASID) {
+          if (PasidCtrl == 0) {
+              if (pal_exerciser_find_pcie_capability(PASID, Bdf, PCIE_REG, &CapabilityOffset)) {
+                  Xfer->status = 1;
+                  continue;
+              }
+              PasidCtrl = Ecam + pal_exerciser_get_pcie_config_offset(Bdf) + CapabilityOffset +
+                          PCIE_CAP_CTRL_OFFSET;
+              pal_mmio_write(PasidCtrl, pal_mmio_read(PasidCtrl) | PCIE_CAP_EN_MASK);
+          }
+          pal_mmio_write(Base + PASID_VAL, Xfer->pasid & PASID_VAL_MASK);
+          Data |= (MASK_BIT << PASID_EN_SHIFT);
+      } else {
+          Data &= PASID_TLP_STOP_MASK;
+      }
+      pal_mmio_write(Base + DMACTL1, Data);
+
+      pal_mmio_write(Base + DMA_BUS_ADDR, (uint32_t)(Xfer->addr & 0xFFFFFFFF));
+      pal_mmio_write(Base + DMA_BUS_ADDR + 4, (uint32_t)(Xfer->addr >> 32));
+      pal_mmio_write(Base + DMA_LEN, Xfer->len);
+
+      Xfer->status = pal_exerciser_start_dma_direction(Base, Xfer->direction);
+  }
+
+  pal_mmio_write(Base + DMACTL1, pal_mmio_read(Base + DMACTL1) & PASID_TLP_STOP_MASK);
+  if (PasidCtrl != 0)
+      pal_mmio_write(PasidCtrl, pal_mmio_read(PasidCtrl) & PCIE_CAP_DIS_MASK);
+
+  return 0;
+}
+
 /**
   @brief   This API reads the configuration parameters of the PCIe stimulus generation hardware
   @param   Type         - Parameter type that needs to be read from the stimulus hadrware
@@ -551,6 +609,9 @@ uint32_t pal_exerciser_ops(EXERCISER_OPS Ops, uint64_t Param, uint32_t Bdf)
             return 1;
         }
 
+  case START_DMA_BATCH:
+        return pal_exerciser_dma_batch(Base, Ecam, Bdf, (exerciser_dma_batch_t *)Param);
+
   case GENERATE_MSI:
         /* Param is the msi_index */
         data = pal_mmio_read(Base + MSICTL);
@@ -56,6 +56,9 @@ payload (void)
   uint32_t test_skip = 1;
   uint32_t msi_index = 0;
   uint32_t msi_cap_offset = 0;
+  uint32_t i;
+  uint32_t num_req = 0;
+  gic_msi_request_t *req;
 
   uint32_t device_id = 0;
   uint32_t stream_id = 0;
@@ -78,6 +81,18 @@ payload (void)
   for (instance = 0; instance < num_smmus; ++instance)
      val_smmu_disable(instance);
 
+  if (num_cards == 0) {
+      val_set_status(index, RESULT_SKIP(2));
+      return;
+  }
+
+  req = val_memory_calloc(num_cards, sizeof(gic_msi_request_t));
+  if (req == NULL) {
+      val_print(ERROR, "\n       Allocation for MSI request list failed");
+      val_set_status(index, RESULT_SKIP(3));
+      return;
+  }
+
   for (instance = 0; instance < num_cards; instance++)
   {
 
@@ -106,7 +121,7 @@ payload (void)
         val_print(ERROR,
             "\n       Could not get device info for BDF : 0x%x", e_bdf);
         val_set_status(index, RESULT_FAIL(1));
-        return;
+        goto free_req;
     }
 
     /* Get ITS Group Index for current device */
@@ -125,13 +140,28 @@ payload (void)
         continue;
     }
 
-    status = val_gic_request_msi(e_bdf, device_id, get_value, base_lpi_id + instance, msi_index);
+    req[num_req].bdf       = e_bdf;
+    req[num_req].device_id = device_id;
+    req[num_req].its_id    = get_value;
+    req[num_req].int_id    = base_lpi_id + instance;
+    req[num_req].msi_index = msi_index;
+    num_req++;
+  }
+
+  /* Map the MSIs of all cards with one ITS command batch */
+  if (num_req) {
+    status = val_gic_request_msi_bulk(req, num_req);
     if (status) {
-        val_print(ERROR,
-            "\n       MSI Assignment failed for bdf : 0x%x", e_bdf);
+        val_print(ERROR, "\n       MSI Assignment failed for exerciser list");
         val_set_status(index, RESULT_FAIL(2));
-        return;
+        goto free_msi;
     }
+  }
+
+  for (i = 0; i < num_req; i++)
+  {
+    e_bdf = req[i].bdf;
+    instance = req[i].int_id - base_lpi_id;
 
     status = val_gic_install_isr(base_lpi_id + instance, intr_handler);
 
@@ -139,7 +169,7 @@ payload (void)
         val_print(ERROR,
             "\n       Intr handler registration failed Interrupt : 0x%x", base_lpi_id + instance);
         val_set_status(index, RESULT_FAIL(3));
-        return;
+        goto free_msi;
     }
 
     /* Set the interrupt trigger status to pending */
@@ -160,15 +190,14 @@ payload (void)
         val_print(ERROR,
             "BDF : 0x%x   ", e_bdf);
         val_set_status(index, RESULT_FAIL(4));
-        val_gic_free_msi(e_bdf, device_id, get_value, base_lpi_id + instance, msi_index);
-        return;
+        goto free_msi;
     }
-
-    /* Clear Interrupt and Mappings */
-    val_gic_free_msi(e_bdf, device_id, get_value, base_lpi_id + instance, msi_index);
-
   }
 
+  /* Clear Interrupt and Mappings of all cards with one ITS command batch */
+  val_gic_free_msi_bulk(req, num_req);
+  val_memory_free(req);
+
   if (test_skip) {
     val_set_status(index, RESULT_SKIP(2));
     return;
@@ -176,7 +205,12 @@ payload (void)
 
   /* Pass Test */
   val_set_status(index, RESULT_PASS);
+  return;
 
+free_msi:
+  val_gic_free_msi_bulk(req, num_req);
+free_req:
+  val_memory_free(req);
 }
 
 uint32_t
@@ -73,6 +73,8 @@ payload(void *arg)
   uint64_t dma_buffer = 0xABCDC0DE12345678;
   uint64_t test_data  = 0x5678567856785678;
   uint8_t  j = 0x2, i = 0;
+  uint32_t num_xfer;
+  exerciser_dma_xfer_t xfer[BUFF_LEN / 2];
   bool     test_skip = 1;
   payload_data_t *payload_data = (payload_data_t *)arg;
 
@@ -141,25 +143,23 @@ payload(void *arg)
           goto test_fail;
       }
 
+      num_xfer = 0;
       while (i < DMA_BUFF_LEN) {
-
-          if (val_exerciser_set_param(DMA_ATTRIBUTES, (uint64_t)(pgt_base_array) + (uint8_t)i,
-                                      2, instance))
-          {
-              val_print(ERROR, "\n       DMA attributes setting failure %4x", instance);
-              goto test_fail;
-          }
-
-          /* Trigger DMA from exerciser memory to output buffer*/
-          if (val_exerciser_ops(START_DMA, EDMA_FROM_DEVICE, instance)) {
-              val_print(ERROR, "\n       DMA read failure from exerciser %4x", instance);
-              goto test_fail;
-          }
+          xfer[num_xfer].addr = (uint64_t)(pgt_base_array) + (uint8_t)i;
+          xfer[num_xfer].len = 2;
+          xfer[num_xfer].direction = EDMA_FROM_DEVICE;
+          xfer[num_xfer].pasid = EXERCISER_DMA_NO_PASID;
+          num_xfer++;
           i = i + 2;
-
       }
       i = 0;
 
+      /* Trigger DMAs from exerciser memory to output buffer */
+      if (val_exerciser_dma_batch(xfer, num_xfer, instance)) {
+          val_print(ERROR, "\n       DMA read failure from exerciser %4x", instance);
+          goto test_fail;
+      }
+
 disable_ro:
       /* Check 2: Disable Relaxed ordering by setting RO = 0 and
        * Send a set of staggered writes to address. The transactions
@@ -198,24 +198,22 @@ disable_ro:
       /* Dump a set of staggered writes from the exerciser memory to the destination address
        * If the writes are in order the output the transactions have been viewed in same order
        * as it was being sent by the exerciser*/
+      num_xfer = 0;
       while (j < BUFF_LEN) {
-
-          if (val_exerciser_set_param(DMA_ATTRIBUTES, (uint64_t)(pgt_base_array) + (uint8_t)j,
-                                      8, instance))
-          {
-              val_print(ERROR, "\n       DMA attributes setting failure %4x", instance);
-              goto test_fail;
-          }
-
-          /* Trigger DMA from exerciser memory to output buffer*/
-          if (val_exerciser_ops(START_DMA, EDMA_FROM_DEVICE, instance)) {
-              val_print(ERROR, "\n       DMA read failure from exerciser %4x", instance);
-              goto test_fail;
-          }
+          xfer[num_xfer].addr = (uint64_t)(pgt_base_array) + (uint8_t)j;
+          xfer[num_xfer].len = 8;
+          xfer[num_xfer].direction = EDMA_FROM_DEVICE;
+          xfer[num_xfer].pasid = EXERCISER_DMA_NO_PASID;
+          num_xfer++;
           j = j + 2;
       }
       j = 0x2;
 
+      if (val_exerciser_dma_batch(xfer, num_xfer, instance)) {
+          val_print(ERROR, "\n       DMA read failure from exerciser %4x", instance);
+          goto test_fail;
+      }
+
       if (val_memory_compare(pgt_base, pgt_base_array, MAX_LEN)) {
           val_print(ERROR, "\n      Data Comparasion failure for Exerciser %4x", instance);
           goto test_fail;
@@ -82,12 +82,21 @@ static void payload_check_s2_64kb_granule_support(void)
 }
 
 
+static int compare_peri_addr(const void *a, const void *b)
+{
+    uint64_t addr1 = *(const uint64_t *)a;
+    uint64_t addr2 = *(const uint64_t *)b;
+
+    return (addr1 > addr2) - (addr1 < addr2);
+}
+
 static void payload_check_peripheral_addr_64kb_apart(void)
 {
     uint32_t pe_index;
-    uint32_t peri_index, peri_index1;
+    uint32_t peri_index, addr_count = 0;
     uint64_t peri_count, addr_diff;
-    uint64_t peri_addr1, peri_addr2;
+    uint64_t peri_addr;
+    uint64_t *peri_addrs;
     uint32_t fail_cnt = 0;
 
     pe_index = val_pe_get_index_mpid(val_pe_get_mpid());
@@ -99,30 +108,37 @@ static void payload_check_peripheral_addr_64kb_apart(void)
         return;
     }
 
-    /* check whether all peripheral base addresses are 64KB apart from each other */
+    peri_addrs = val_memory_alloc(peri_count * sizeof(uint64_t));
+    if (peri_addrs == NULL) {
+        val_print(ERROR, "\n       Failed to allocate peripheral address list");
+        val_set_status(pe_index, RESULT_SKIP(02));
+        return;
+    }
+
     for (peri_index = 0 ; peri_index < peri_count; peri_index++) {
-        for (peri_index1 = peri_index + 1; peri_index1 < peri_count; peri_index1++) {
+        peri_addr = val_peripheral_get_info(ANY_BASE0, peri_index);
+        val_print(TRACE, "\n   addr of Peripheral %d", peri_index);
+        val_print(TRACE, " is  %llx", peri_addr);
 
-            peri_addr1 = val_peripheral_get_info(ANY_BASE0, peri_index);
-            peri_addr2 = val_peripheral_get_info(ANY_BASE0, peri_index1);
-            val_print(TRACE, "\n   addr of Peripheral 1 is  %llx", peri_addr1);
-            val_print(TRACE, "\n   addr of Peripheral 2 is  %llx", peri_addr2);
+        if (peri_addr != 0)
+            peri_addrs[addr_count++] = peri_addr;
+    }
 
-           if ((peri_addr1 == 0) || (peri_addr2 == 0)) {
-                continue;
-           }
+    /* Once sorted, all base addresses are 64KB apart if every neighbouring pair is */
+    val_sort(peri_addrs, addr_count, sizeof(uint64_t), compare_peri_addr);
 
-            addr_diff = (peri_addr1 > peri_addr2) ?
-                         peri_addr1 - peri_addr2 : peri_addr2 - peri_addr1;
+    for (peri_index = 1; peri_index < addr_count; peri_index++) {
+        addr_diff = peri_addrs[peri_index] - peri_addrs[peri_index - 1];
 
-            if (addr_diff < MEM_SIZE_64KB) {
-                val_print(ERROR,
-                         "\n  Peripheral base addresses isn't atleast 64Kb apart %llx", addr_diff);
-                fail_cnt++;
-            }
+        if (addr_diff < MEM_SIZE_64KB) {
+            val_print(ERROR,
+                     "\n  Peripheral base addresses isn't atleast 64Kb apart %llx", addr_diff);
+            fail_cnt++;
         }
     }
 
+    val_memory_free(peri_addrs);
+
     if (fail_cnt) {
         val_set_status(pe_index, RESULT_FAIL(01));
     } else {
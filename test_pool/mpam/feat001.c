@@ -216,11 +216,9 @@ payload(void)
 
             /* Step 5: Start mem copy */
             val_memcpy(src_buf, dest_buf, BUFFER_SIZE);
-            /* Wait for some time before the memcpy settles and counters update */
-            val_time_delay_ms(TIMEOUT_MEDIUM);
 
             /* Read CSU monitor cnt - number of cache lines filled by PARTID_X at this point */
-            end_count = val_mpam_read_csumon(msc_index);
+            end_count = val_mpam_wait_csumon(msc_index, TIMEOUT_MEDIUM);
 
             /* Disable CSU MON */
             val_mpam_csumon_disable(msc_index);
@@ -284,11 +282,9 @@ payload(void)
             };
 
             val_memcpy(src_buf, dest_buf, BUFFER_SIZE);
-            /* Wait for some time before the memcpy settles and counters update */
-            val_time_delay_ms(TIMEOUT_MEDIUM);
 
             /* Step 9 */
-            end_count = val_mpam_read_csumon(msc_index);
+            end_count = val_mpam_wait_csumon(msc_index, TIMEOUT_MEDIUM);
 
             /* Disable CSU MON */
             val_mpam_csumon_disable(msc_index);
@@ -348,10 +344,8 @@ payload(void)
             };
 
             val_memcpy(src_buf, dest_buf, BUFFER_SIZE);
-            /* Wait for some time before the memcpy settles and counters update */
-            val_time_delay_ms(TIMEOUT_MEDIUM);
 
-            end_count = val_mpam_read_csumon(msc_index);
+            end_count = val_mpam_wait_csumon(msc_index, TIMEOUT_MEDIUM);
 
             /* Disable CSU MON */
             val_mpam_csumon_disable(msc_index);
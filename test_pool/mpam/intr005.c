@@ -79,9 +79,8 @@ mbwu_prepare_overflow_intr(uint32_t msc_idx,
     val_mpam_mbwu_wait_for_update(msc_idx);
 
     val_memcpy(src_buf, dest_buf, buf_size);
-    /* Wait for some time before the memcpy settles and counters update */
-    val_time_delay_ms(TIMEOUT_MEDIUM);
-    val_mpam_mbwu_wait_for_update(msc_idx);
+    /* Wait for the memcpy traffic to settle in the counter */
+    val_mpam_wait_mbwumon(msc_idx, TIMEOUT_MEDIUM);
 
     /* Overflow is cleared in the handler */
     if (val_mpam_mbwu_is_overflow_set(msc_idx)) {
@@ -216,16 +215,17 @@ void payload(void)
 
             test_skip = 0;
 
-            status = val_mpam_msc_request_msi(msc_index, device_id, its_id,
-                                              msi_intr_num, 1 /* oflow_msi */);
-            if (status) {
-                val_print(ERROR,
-                    "\n       MSI Assignment failed for MSC %d", msc_index);
-                test_fail++;
-                goto monitor_cleanup;
-            }
-
+            /* The MSC keeps one overflow MSI across its resources, map it once */
             if (!handler_installed) {
+                status = val_mpam_msc_request_msi(msc_index, device_id, its_id,
+                                                  msi_intr_num, 1 /* oflow_msi */);
+                if (status) {
+                    val_print(ERROR,
+                        "\n       MSI Assignment failed for MSC %d", msc_index);
+                    test_fail++;
+                    goto monitor_cleanup;
+                }
+
                 status = val_gic_install_isr(msi_intr_num, intr_handler);
                 if (status) {
                     val_print(ERROR,
@@ -289,14 +289,7 @@ void payload(void)
 
                 /* perform memory operation */
                 val_memcpy(src_buf, dest_buf, buf_size);
-                /* Wait for some time before the memcpy settles and counters update */
-                val_time_delay_ms(TIMEOUT_MEDIUM);
-
-                while (nrdy_timeout) {
-                    --nrdy_timeout;
-                };
-
-                end_count = val_mpam_memory_mbwumon_read_count(msc_index);
+                end_count = val_mpam_wait_mbwumon(msc_index, TIMEOUT_MEDIUM);
                 val_print(INFO, "\n        End count is %llx", end_count);
 
                 /* read the memory bandwidth usage monitor */
@@ -375,10 +375,8 @@ payload_primary(void)
                 val_print(INFO, "\n       Start Count = 0x%llx", start_count);
                 /* perform memory operation */
                 val_memcpy((void *)src_buf, (void *)dest_buf, buf_size);
-                /* Wait for some time before the memcpy settles and counters update */
-                val_time_delay_ms(TIMEOUT_MEDIUM);
 
-                end_count = val_mpam_memory_mbwumon_read_count(msc_index);
+                end_count = val_mpam_wait_mbwumon(msc_index, TIMEOUT_MEDIUM);
                 val_print(INFO, "\n       End Count = 0x%llx", end_count);
                 /* read the memory bandwidth usage monitor */
                 counter[msc_index][rsrc_index][scenario_cnt] = end_count - start_count;
@@ -432,9 +430,7 @@ payload_primary(void)
 
                 /* perform memory operation */
                 val_memcpy((void *)src_buf, (void *)dest_buf, buf_size);
-                /* Wait for some time before the memcpy settles and counters update */
-                val_time_delay_ms(TIMEOUT_MEDIUM);
-                end_count = val_mpam_memory_mbwumon_read_count(msc_index);
+                end_count = val_mpam_wait_mbwumon(msc_index, TIMEOUT_MEDIUM);
                 val_print(INFO, "\n       End Count = 0x%llx", end_count);
 
                 /* read the memory bandwidth usage monitor */
@@ -214,11 +214,9 @@ static void payload(void)
 
         /*Perform first memory transaction */
         val_memcpy(src_buf, dest_buf, buf_size);
-        /* Wait for some time before the memcpy settles and counters update */
-        val_time_delay_ms(TIMEOUT_MEDIUM);
 
         /* Read Cache storage value */
-        storage_value1 = val_mpam_read_csumon(msc_index);
+        storage_value1 = val_mpam_wait_csumon(msc_index, TIMEOUT_MEDIUM);
         val_print(DEBUG, "\n       Storage Value 1 = 0x%x", storage_value1);
 
         val_pe_cache_invalidate_range((uint64_t)src_buf, buf_size);
@@ -244,11 +242,9 @@ static void payload(void)
 
         /*Perform second memory transaction */
         val_memcpy(src_buf, dest_buf, buf_size);
-        /* Wait for some time before the memcpy settles and counters update */
-        val_time_delay_ms(TIMEOUT_MEDIUM);
 
         /* Read Cache storage value for PMG2 */
-        storage_value2 = val_mpam_read_csumon(msc_index);
+        storage_value2 = val_mpam_wait_csumon(msc_index, TIMEOUT_MEDIUM);
         val_print(DEBUG, "\n       Storage Value 2 = 0x%x", storage_value2);
 
         /* Disable the monitor */
@@ -175,13 +175,7 @@ payload(void)
 
             /* Start mem copy */
             val_memcpy(src_buf, dest_buf, BUFFER_SIZE);
-            /* Wait for some time before the memcpy settles and counters update */
-            val_time_delay_ms(TIMEOUT_MEDIUM);
-
-            /* Add Delay */
-            val_time_delay_ms(100 * ONE_MILLISECOND);
-
-            end_count = val_mpam_read_csumon(msc_index);
+            end_count = val_mpam_wait_csumon(msc_index, TIMEOUT_MEDIUM);
             val_print(DEBUG, "\n       End Count = 0x%lx", end_count);
 
             if (start_count != end_count) {
@@ -140,9 +140,8 @@ payload(void)
       val_mpam_mmr_write(msc_index, REG_MSMON_CFG_MBWU_CTL, data32);
 
       val_memcpy(src_buf, dest_buf, buf_size);
-      /* Wait for some time before the memcpy settles and counters update */
-      val_time_delay_ms(TIMEOUT_MEDIUM);
-      val_mpam_mbwu_wait_for_update(msc_index);
+      /* Wait for the memcpy traffic to settle in the counter */
+      val_mpam_wait_mbwumon(msc_index, TIMEOUT_MEDIUM);
 
       if (!val_mpam_mbwu_is_overflow_set(msc_index)) {
         val_print(ERROR,
@@ -161,11 +160,8 @@ payload(void)
       }
 
       val_memcpy(src_buf, dest_buf, buf_size);
-      /* Wait for some time before the memcpy settles and counters update */
-      val_time_delay_ms(TIMEOUT_MEDIUM);
-      val_mpam_mbwu_wait_for_update(msc_index);
 
-      freeze_post_count = val_mpam_memory_mbwumon_read_count(msc_index);
+      freeze_post_count = val_mpam_wait_mbwumon(msc_index, TIMEOUT_MEDIUM);
       /* Compare Count when OFLOW_FRZ is set */
       if (freeze_post_count != freeze_overflow_count) {
         val_print(ERROR,
@@ -201,9 +197,8 @@ post_freeze_cleanup:
       val_mpam_mmr_write(msc_index, REG_MSMON_CFG_MBWU_CTL, data32);
 
       val_memcpy(src_buf, dest_buf, buf_size);
-      /* Wait for some time before the memcpy settles and counters update */
-      val_time_delay_ms(TIMEOUT_MEDIUM);
-      val_mpam_mbwu_wait_for_update(msc_index);
+      /* Wait for the memcpy traffic to settle in the counter */
+      val_mpam_wait_mbwumon(msc_index, TIMEOUT_MEDIUM);
 
       if (!val_mpam_mbwu_is_overflow_set(msc_index)) {
         val_print(ERROR,
@@ -222,11 +217,8 @@ post_freeze_cleanup:
       }
 
       val_memcpy(src_buf, dest_buf, buf_size);
-      /* Wait for some time before the memcpy settles and counters update */
-      val_time_delay_ms(TIMEOUT_MEDIUM);
-      val_mpam_mbwu_wait_for_update(msc_index);
 
-      run_post_count = val_mpam_memory_mbwumon_read_count(msc_index);
+      run_post_count = val_mpam_wait_mbwumon(msc_index, TIMEOUT_MEDIUM);
       /* Check if Monitor Read Failed */
       if (run_post_count == (uint64_t)MPAM_MON_NOT_READY) {
         val_print(ERROR,
@@ -68,9 +68,8 @@ mbwu_prepare_overflow(uint32_t msc_index, void *src_buf, void *dest_buf, uint64_
   val_mpam_mmr_write(msc_index, REG_MSMON_CFG_MBWU_CTL, ctl);
 
   val_memcpy(src_buf, dest_buf, buf_size);
-  /* Wait for some time before the memcpy settles and counters update */
-  val_time_delay_ms(TIMEOUT_MEDIUM);
-  val_mpam_mbwu_wait_for_update(msc_index);
+  /* Wait for the memcpy traffic to settle in the counter */
+  val_mpam_wait_mbwumon(msc_index, TIMEOUT_MEDIUM);
 
   if (!val_mpam_mbwu_is_overflow_set(msc_index)) {
     val_print(ERROR,
@@ -185,11 +184,8 @@ payload(void)
 
       /* Issue traffic after clearing via control to exercise the resume path */
       val_memcpy(src_buf, dest_buf, buf_size);
-      /* Wait for some time before the memcpy settles and counters update */
-      val_time_delay_ms(TIMEOUT_MEDIUM);
-      val_mpam_mbwu_wait_for_update(msc_index);
 
-      resumed_count = val_mpam_memory_mbwumon_read_count(msc_index);
+      resumed_count = val_mpam_wait_mbwumon(msc_index, TIMEOUT_MEDIUM);
       /* Check if Monitor Read Failed */
       if (resumed_count == (uint64_t)MPAM_MON_NOT_READY) {
         val_print(ERROR,
@@ -235,11 +231,8 @@ payload(void)
 
       /* Repeat the traffic sequence after clearing via counter write */
       val_memcpy(src_buf, dest_buf, buf_size);
-      /* Wait for some time before the memcpy settles and counters update */
-      val_time_delay_ms(TIMEOUT_MEDIUM);
-      val_mpam_mbwu_wait_for_update(msc_index);
 
-      resumed_count = val_mpam_memory_mbwumon_read_count(msc_index);
+      resumed_count = val_mpam_wait_mbwumon(msc_index, TIMEOUT_MEDIUM);
       /* Check if Monitor Read Failed */
       if (resumed_count == (uint64_t)MPAM_MON_NOT_READY) {
         val_print(ERROR,
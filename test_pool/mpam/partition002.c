@@ -215,10 +215,8 @@ static void payload(void)
 
             /* Start mem copy */
             val_memcpy(src_buf, dest_buf, buf_size);
-            /* Wait for some time before the memcpy settles and counters update */
-            val_time_delay_ms(TIMEOUT_MEDIUM);
 
-            end_count = val_mpam_read_csumon(msc_index);
+            end_count = val_mpam_wait_csumon(msc_index, TIMEOUT_MEDIUM);
             val_print(DEBUG, "\n       End Count = 0x%lx", end_count);
 
             /* Disable CSU MON */
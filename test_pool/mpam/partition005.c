@@ -199,17 +199,9 @@ payload(void)
 
             /* Step 5 -  Trigger buffercpy workload */
             val_memcpy(src_buf, dest_buf, BUFFER_SIZE);
-            /* Wait for some time before the memcpy settles and counters update */
-            val_time_delay_ms(TIMEOUT_MEDIUM);
-
-            /* wait for some time till memcpy settles */
-            buf_timeout = TIMEOUT_MEDIUM;
-            while (buf_timeout) {
-                --buf_timeout;
-            };
 
             /* Step 6 - Read the Cache line count used by PARTID X from CSU MON */
-            counter[0] = val_mpam_read_csumon(msc_index);
+            counter[0] = val_mpam_wait_csumon(msc_index, TIMEOUT_MEDIUM);
             val_print(INFO, "\n       Scenario 1: End Count = 0x%lx", counter[0]);
 
             /* Disable CSU MON */
@@ -271,17 +263,9 @@ payload(void)
             val_mpam_csumon_enable(msc_index);
 
             val_memcpy(src_buf, dest_buf, BUFFER_SIZE);
-            /* Wait for some time before the memcpy settles and counters update */
-            val_time_delay_ms(TIMEOUT_MEDIUM);
-
-            /* wait for some time till memcpy settles */
-            buf_timeout = TIMEOUT_MEDIUM;
-            while (buf_timeout) {
-                --buf_timeout;
-            };
 
             /* Step 11: Measure cache usage again with the CSU monitor */
-            counter[1] = val_mpam_read_csumon(msc_index);
+            counter[1] = val_mpam_wait_csumon(msc_index, TIMEOUT_MEDIUM);
             val_print(INFO, "\n       Scenario 2: End Count = 0x%lx", counter[1]);
 
             /* Compare the result. Counter[1] should be more than Counter[0]. The softlimiting
@@ -194,11 +194,8 @@ payload(void)
 
             val_memcpy(dest_buf, src_buf, BUFFER_SIZE);
 
-            /* Wait for some time before the memcpy settles and counters update */
-            val_time_delay_ms(TIMEOUT_MEDIUM);
-
             /* Read the monitor counter for PARTID_X */
-            counter[0] = val_mpam_read_csumon(msc_index);
+            counter[0] = val_mpam_wait_csumon(msc_index, TIMEOUT_MEDIUM);
             val_print(INFO, "\n       PARTID_X Counter: 0x%x", counter[0]);
 
             /* Disable CSU MON */
@@ -232,11 +229,8 @@ payload(void)
 
             val_memcpy(dest_buf, src_buf, BUFFER_SIZE);
 
-            /* Wait for some time before the memcpy settles and counters update */
-            val_time_delay_ms(TIMEOUT_MEDIUM);
-
             /* Read the monitor counter for PARTID_Y */
-            counter[1] = val_mpam_read_csumon(msc_index);
+            counter[1] = val_mpam_wait_csumon(msc_index, TIMEOUT_MEDIUM);
             val_print(INFO, "\n       PARTID_Y Counter: 0x%x", counter[1]);
 
             /* Read PARTID_X counter after the second buffer copy */
@@ -284,11 +278,8 @@ payload(void)
             /* Perform buffer copy */
             val_memcpy(dest_buf, src_buf, BUFFER_SIZE);
 
-            /* Wait for some time before the memcpy settles and counters update */
-            val_time_delay_ms(TIMEOUT_MEDIUM);
-
             /* Read the monitor counter for PARTID_Z */
-            if (val_mpam_read_csumon(msc_index) <= counter[2]) {
+            if (val_mpam_wait_csumon(msc_index, TIMEOUT_MEDIUM) <= counter[2]) {
                 val_print(ERROR,
                     "\n       PARTID_Z usage did not increase after workload, failing test");
                 test_fail = 1;
@@ -24,7 +24,7 @@
 #define TEST_RULE "B_WAK_03, B_WAK_07"
 #define TEST_DESC "Wake from EL1 PHY Timer Int           "
 
-static uint32_t g_el1phy_int_received;
+static volatile uint32_t g_el1phy_int_received;
 static
 void
 isr1()
@@ -46,7 +46,6 @@ payload1()
 {
   uint32_t intid;
   uint32_t index = val_pe_get_index_mpid(val_pe_get_mpid());
-  uint32_t delay_loop = MAX_SPIN_LOOPS;
   uint32_t timer_expire_val =
       CEIL_TO_MAX_SYS_TIMEOUT(val_get_timeout_to_ticks(acs_policy_get_timeout_pass()));
 
@@ -60,16 +59,13 @@ payload1()
   val_timer_set_phy_el1(timer_expire_val);
   val_power_enter_semantic(BSA_POWER_SEM_B);
 
-  /* Add a delay loop after WFI called in case PE needs some time to enter WFI state
+  /* Wait after WFI in case PE needs some time to enter WFI state
    * exit if test int comes
    *
-   * This delay loop is a bounded spin wait used only to wait for the
-   * interrupt to arrive. It is not time-based and does not represent
-   * system counter ticks.
+   * The wait is bounded by the pass timeout on the system counter, the
+   * interval in which the programmed test interrupt must arrive.
   */
-  while (delay_loop && (g_el1phy_int_received == 0)) {
-      delay_loop--;
-  }
+  val_wait_for_flags(&g_el1phy_int_received, NULL, acs_policy_get_timeout_pass());
 
   /* We are here means
    * 1. test interrupt has come (PASS) isr1
@@ -84,7 +80,6 @@ payload1()
       val_print(DEBUG, "\n       PE wakeup by some other events/int");
       val_set_status(index, RESULT_SKIP(2));
   }
-  val_print(TRACE, "\n       delay loop remainig value %d", delay_loop);
   return;
 }
 
@@ -24,8 +24,8 @@
 #define TEST_RULE "B_WAK_03, B_WAK_07"
 #define TEST_DESC "Wake from EL2 PHY Timer Int           "
 
-static uint32_t g_el2phy_int_rcvd;
-static uint32_t g_failsafe_int_rcvd;
+static volatile uint32_t g_el2phy_int_rcvd;
+static volatile uint32_t g_failsafe_int_rcvd;
 static
 void
 isr_failsafe()
@@ -92,7 +92,6 @@ payload3()
 {
   uint32_t intid;
   uint32_t index = val_pe_get_index_mpid(val_pe_get_mpid());
-  uint32_t delay_loop = MAX_SPIN_LOOPS;
   uint32_t timer_expire_val =
       CEIL_TO_MAX_SYS_TIMEOUT(val_get_timeout_to_ticks(acs_policy_get_timeout_pass()));
 
@@ -109,16 +108,13 @@ payload3()
 
   val_power_enter_semantic(BSA_POWER_SEM_B);
 
-  /* Add a delay loop after WFI called in case PE needs some time to enter WFI state
+  /* Wait after WFI in case PE needs some time to enter WFI state
    * exit in case test or failsafe int is received
    *
-   * This delay loop is a bounded spin wait used only to wait for the
-   * interrupt to arrive. It is not time-based and does not represent
-   * system counter ticks.
+   * The wait is bounded by the pass timeout on the system counter, the
+   * interval in which the programmed test interrupt must arrive.
   */
-  while (delay_loop && (g_el2phy_int_rcvd == 0) && (g_failsafe_int_rcvd == 0)) {
-      delay_loop--;
-  }
+  val_wait_for_flags(&g_el2phy_int_rcvd, &g_failsafe_int_rcvd, acs_policy_get_timeout_pass());
 
   /* We are here means
    * 1. test interrupt has come (PASS) isr3
@@ -136,7 +132,6 @@ payload3()
                 "\n       PE wakeup by some other events/int or didn't enter WFI");
       val_set_status(index, RESULT_SKIP(1));
   }
-  val_print(TRACE, "\n       delay loop remainig value %d", delay_loop);
   return;
 }
 
@@ -25,8 +25,8 @@
 #define TEST_DESC "Wake from Watchdog WS0 Int            "
 
 static uint64_t wd_num;
-static uint32_t g_wd_int_received;
-static uint32_t g_failsafe_int_received;
+static volatile uint32_t g_wd_int_received;
+static volatile uint32_t g_failsafe_int_received;
 static
 void
 isr_failsafe()
@@ -91,7 +91,6 @@ payload4()
   uint32_t status;
   uint32_t ns_wdg = 0;
   uint32_t intid;
-  uint32_t delay_loop = MAX_SPIN_LOOPS;
   uint32_t index = val_pe_get_index_mpid(val_pe_get_mpid());
   uint64_t timer_expire_val = val_get_timeout_to_ticks(acs_policy_get_timeout_pass());
 
@@ -134,16 +133,14 @@ payload4()
           }
           val_power_enter_semantic(BSA_POWER_SEM_B);
 
-          /* Add a delay loop after WFI called in case PE needs some time to enter WFI state
+          /* Wait after WFI in case PE needs some time to enter WFI state
            * exit in case test or failsafe int is received
            *
-           * This delay loop is a bounded spin wait used only to wait for the
-           * interrupt to arrive. It is not time-based and does not represent
-           * system counter ticks.
+           * The wait is bounded by the pass timeout on the system counter, the
+           * interval in which the programmed test interrupt must arrive.
           */
-	  while (delay_loop && (g_wd_int_received == 0) && (g_failsafe_int_received == 0)) {
-              delay_loop--;
-          }
+          val_wait_for_flags(&g_wd_int_received, &g_failsafe_int_received,
+                             acs_policy_get_timeout_pass());
 
           /* We are here means
            * 1. test interrupt has come (PASS) isr4
@@ -160,7 +157,6 @@ payload4()
                         "\n       PE wakeup by some other events/int or didn't enter WFI");
               val_set_status(index, RESULT_SKIP(1));
 	  }
-	  val_print(DEBUG, "\n       delay loop remainig value %d", delay_loop);
       } else {
           val_print(WARN, "\n       GIC Install Handler Failed...");
           val_set_status(index, RESULT_FAIL(3));
@@ -154,8 +154,8 @@ payload()
         break;
       }
 
-      /* Wait loop */
-      val_ras_wait_timeout(1);
+      /* Wait for the error interrupt */
+      val_ras_wait_error(node_index, &intr_pending, RAS_ERR_LATCH_TIMEOUT_US);
 
       if (intr_pending) {
         val_print(ERROR, "\n       Not Connected to GIC for node %d", node_index);
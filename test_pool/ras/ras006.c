@@ -186,8 +186,8 @@ payload()
           val_print(DEBUG, "\n       Error injected address: 0x%llx", err_inj_addr);
           val_print(DEBUG, "  Data read: 0x%lx", err_inj_addr_data);
 
-          /* wait loop to allow system to update RAS error records */
-          val_ras_wait_timeout(1);
+          /* wait for the system to update RAS error records */
+          val_ras_wait_error(node_index, NULL, RAS_ERR_LATCH_TIMEOUT_US);
 
           /* get error record implemented bitmap from RAS info table */
           status = val_ras_get_info(RAS_INFO_ERR_REC_IMP, node_index, &err_rec_impl_bitmap);
@@ -41,12 +41,19 @@ isr()
 }
 
 
+static
+uint32_t
+result_not_pending(void *arg)
+{
+  return !IS_RESULT_PENDING(val_get_status(*(uint32_t *)arg));
+}
+
 static
 void
 payload()
 {
 
-  volatile uint32_t timeout;
+  uint32_t timeout_us;
   uint32_t timer_expire_val = TIMEOUT_MEDIUM;
   uint32_t status, ns_timer = 0;
   uint32_t index = val_pe_get_index_mpid(val_pe_get_mpid());
@@ -58,6 +65,10 @@ payload()
       return;
   }
 
+  /* Allow the programmed expiry plus the failsafe timeout for the interrupt */
+  timeout_us = (uint32_t)(((uint64_t)timer_expire_val * MICRO_SECONDS) /
+                          val_get_counter_frequency()) + acs_policy_get_timeout_fail();
+
   while (timer_num) {
       timer_num--;  //array index starts from 0, so subtract 1 from count
 
@@ -65,7 +76,6 @@ payload()
           continue;    //Skip Secure Timer
 
       ns_timer++;
-      timeout = TIMEOUT_LARGE;
       val_set_status(index, RESULT_PENDING(TEST_NUM));     // Set the initial result to pending
 
       //Read CNTACR to determine whether access permission from NS state is permitted
@@ -103,10 +113,7 @@ payload()
       /* enable System timer */
       val_timer_set_system_timer((addr_t)cnt_base_n, timer_expire_val);
 
-      while ((--timeout > 0) && (IS_RESULT_PENDING(val_get_status(index))))
-      ;
-
-      if (timeout == 0) {
+      if (!val_wait_until(result_not_pending, &index, timeout_us)) {
           val_print(ERROR, "\n       Sys timer interrupt not received on %d   ", intid);
           val_set_status(index, RESULT_FAIL(3));
           return;
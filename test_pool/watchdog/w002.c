@@ -96,7 +96,7 @@ payload()
 {
 
     uint32_t status, ns_wdg = 0;
-    uint64_t timeout;
+    uint32_t received;
     uint64_t timer_expire_ticks = val_get_timeout_to_ticks(acs_policy_get_timeout_pass());
     uint32_t index = val_pe_get_index_mpid(val_pe_get_mpid());
     wd_num = val_wd_get_info(0, WD_INFO_COUNT);
@@ -153,12 +153,8 @@ payload()
         }
         wakeup_set_failsafe();
 
-        timeout = val_get_timeout_to_ticks(acs_policy_get_timeout_fail());
-        while (timeout && (g_wd_int_received == 0) && (g_failsafe_int_received == 0)) {
-          val_data_cache_ops_by_va((addr_t)&g_wd_int_received, INVALIDATE);
-          val_data_cache_ops_by_va((addr_t)&g_failsafe_int_received, INVALIDATE);
-          timeout--;
-        }
+        received = val_wait_for_flags(&g_wd_int_received, &g_failsafe_int_received,
+                                      acs_policy_get_timeout_fail());
 
         wakeup_clear_failsafe();
         val_wd_set_ws0(wd_num, 0);
@@ -169,7 +165,7 @@ payload()
           return;
         }
 
-        if ((timeout == 0) && (g_wd_int_received == 0)) {
+        if ((received == 0) && (g_wd_int_received == 0)) {
             val_print(ERROR, "\n       WS0 Interrupt not rcvd within timeout %d", int_id);
             val_set_status(index, RESULT_FAIL(5));
             return;
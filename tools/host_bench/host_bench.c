@@ -0,0 +1,502 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+/*
+ * Micro-benchmarks for the VAL info table build and lookup paths and the VAL
+ * memory copy routines, run on the host against the synthetic PAL in
+ * host_pal.c. See README.md.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "host_bench.h"
+#include "acs_val.h"
+#include "acs_common.h"
+#include "acs_pcie.h"
+#include "acs_pcie_spec.h"
+#include "acs_iovirt.h"
+#include "acs_execution_policy.h"
+#include "val_interface.h"
+
+/* Not exported by acs_pcie.h; the harness drops it between build runs */
+extern pcie_device_bdf_table *g_pcie_bdf_table;
+
+#define HOST_BDF_TABLE_CAPACITY \
+  ((PCIE_DEVICE_BDF_TABLE_SZ - sizeof(pcie_device_bdf_table)) / sizeof(pcie_device_attr))
+
+typedef struct {
+  const char *name;
+  void       (*prepare)(void);       ///< untimed, before every repetition
+  uint32_t   (*run)(uint32_t iters); ///< timed; returns operations done, 0 on failure
+} HOST_BENCH;
+
+static uint32_t g_iters = 20000;
+static uint32_t g_reps = 5;
+static volatile uint64_t g_sink;
+
+static uint64_t
+host_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* ------------------------------------------------------------------------ */
+/* PCIe                                                                     */
+/* ------------------------------------------------------------------------ */
+
+static void
+bench_pcie_create_prepare(void)
+{
+  if (g_pcie_bdf_table != NULL) {
+      pal_mem_free_aligned(g_pcie_bdf_table);
+      g_pcie_bdf_table = NULL;
+  }
+  val_pcie_free_info_table();
+}
+
+static uint32_t
+bench_pcie_create(uint32_t iters)
+{
+  uint64_t *table = pal_aligned_alloc(MEM_ALIGN_4K, host_pcie_info_table_size());
+  pcie_device_bdf_table *bdf_tbl;
+
+  if (table == NULL)
+      return 0;
+
+  val_pcie_create_info_table(table);
+
+  bdf_tbl = g_pcie_bdf_table;
+  if ((bdf_tbl == NULL) || (bdf_tbl->num_entries != host_topology_cfg()->num_bdfs)) {
+      printf("pcie_create_info_table: %u BDFs found, %u expected\n",
+             bdf_tbl ? bdf_tbl->num_entries : 0, host_topology_cfg()->num_bdfs);
+      return 0;
+  }
+
+  return bdf_tbl->num_entries;
+}
+
+static uint32_t
+bench_pcie_read_cfg(uint32_t iters)
+{
+  uint32_t i, data;
+
+  for (i = 0; i < iters; i++) {
+      val_pcie_read_cfg(host_pcie_endpoint_bdf(i), TYPE01_VIDR, &data);
+      g_sink += data;
+  }
+  return iters;
+}
+
+static uint32_t
+bench_pcie_find_capability(uint32_t iters)
+{
+  uint32_t i, offset;
+
+  for (i = 0; i < iters; i++) {
+      if (val_pcie_find_capability(host_pcie_endpoint_bdf(i), PCIE_CAP, CID_PCIECS, &offset))
+          return 0;
+      g_sink += offset;
+  }
+  return iters;
+}
+
+static uint32_t
+bench_pcie_get_rootport(uint32_t iters)
+{
+  uint32_t i, bdf, rp_bdf, reg_value;
+
+  for (i = 0; i < iters; i++) {
+      bdf = host_pcie_endpoint_bdf(i);
+      if (val_pcie_get_rootport(bdf, &rp_bdf))
+          return 0;
+
+      val_pcie_read_cfg(rp_bdf, TYPE1_PBN, &reg_value);
+      if (((reg_value >> SECBN_SHIFT) & SECBN_MASK) != PCIE_EXTRACT_BDF_BUS(bdf)) {
+          printf("pcie_get_rootport: bdf 0x%x resolved to 0x%x\n", bdf, rp_bdf);
+          return 0;
+      }
+  }
+  return iters;
+}
+
+/* ------------------------------------------------------------------------ */
+/* IO virtualisation                                                        */
+/* ------------------------------------------------------------------------ */
+
+static void
+bench_iovirt_create_prepare(void)
+{
+  val_iovirt_free_info_table();
+}
+
+static uint32_t
+bench_iovirt_create(uint32_t iters)
+{
+  uint64_t *table = pal_aligned_alloc(MEM_ALIGN_4K, host_iovirt_info_table_size());
+
+  if (table == NULL)
+      return 0;
+
+  val_iovirt_create_info_table(table);
+  if (val_iovirt_get_smmu_info(SMMU_NUM_CTRL, 0) != host_topology_cfg()->num_smmus)
+      return 0;
+
+  return 1;
+}
+
+static uint32_t
+bench_iovirt_get_device_info(uint32_t iters)
+{
+  uint32_t i, bdf, rid, device_id, stream_id, its_id;
+
+  for (i = 0; i < iters; i++) {
+      bdf = host_pcie_endpoint_bdf(i);
+      rid = (uint32_t)PCIE_CREATE_BDF_PACKED(bdf);
+      if (val_iovirt_get_device_info(rid, PCIE_EXTRACT_BDF_SEG(bdf),
+                                     &device_id, &stream_id, &its_id))
+          return 0;
+
+      if ((stream_id != ((PCIE_EXTRACT_BDF_SEG(bdf) << 16) | rid)) ||
+          (its_id != HOST_ITS_ID)) {
+          printf("iovirt_get_device_info: rid 0x%x sid 0x%x its %u\n", rid, stream_id, its_id);
+          return 0;
+      }
+  }
+  return iters;
+}
+
+static uint32_t
+bench_iovirt_get_rc_smmu_index(uint32_t iters)
+{
+  uint32_t i, bdf, index;
+
+  for (i = 0; i < iters; i++) {
+      bdf = host_pcie_endpoint_bdf(i);
+      index = val_iovirt_get_rc_smmu_index(PCIE_EXTRACT_BDF_SEG(bdf),
+                                           PCIE_CREATE_BDF_PACKED(bdf));
+      if (index == ACS_INVALID_INDEX)
+          return 0;
+      g_sink += index;
+  }
+  return iters;
+}
+
+/* ------------------------------------------------------------------------ */
+/* PE                                                                       */
+/* ------------------------------------------------------------------------ */
+
+static void
+bench_pe_create_prepare(void)
+{
+  val_pe_free_info_table();
+}
+
+static uint32_t
+bench_pe_create(uint32_t iters)
+{
+  uint64_t *table = pal_aligned_alloc(MEM_ALIGN_4K, host_pe_info_table_size());
+
+  if (table == NULL)
+      return 0;
+
+  if (val_pe_create_info_table(table) != ACS_STATUS_PASS)
+      return 0;
+
+  return val_pe_get_num();
+}
+
+static uint32_t
+bench_pe_get_index_mpid(uint32_t iters)
+{
+  uint32_t i, num_pe = host_topology_cfg()->num_pes;
+
+  for (i = 0; i < iters; i++) {
+      if (val_pe_get_index_mpid(host_pe_mpidr(i % num_pe)) != (i % num_pe)) {
+          printf("pe_get_index_mpid: PE %u not found\n", i % num_pe);
+          return 0;
+      }
+  }
+  return iters;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Logger                                                                   */
+/* ------------------------------------------------------------------------ */
+
+static uint32_t
+bench_print_suppressed(uint32_t iters)
+{
+  uint32_t i;
+
+  for (i = 0; i < iters; i++)
+      val_print(DEBUG, " BDF 0x%06x RP 0x%06x\n", i, i);
+  return iters;
+}
+
+static uint32_t
+bench_print_emitted(uint32_t iters)
+{
+  uint32_t i;
+
+  for (i = 0; i < iters; i++)
+      val_print(ERROR, " BDF 0x%06x RP 0x%06x\n", i, i);
+  return iters;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Memory copy and fill                                                     */
+/* ------------------------------------------------------------------------ */
+
+/* One copy or fill per operation. The buffers fit in L2 on common hosts, so
+   the loops rather than DRAM bandwidth are measured. */
+#define HOST_COPY_SIZE  (16 * 1024)
+#define HOST_COPY_SLACK 16
+
+static uint8_t g_copy_src[HOST_COPY_SIZE + HOST_COPY_SLACK] __attribute__((aligned(64)));
+static uint8_t g_copy_dst[HOST_COPY_SIZE + HOST_COPY_SLACK] __attribute__((aligned(64)));
+
+static void
+bench_copy_prepare(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < sizeof(g_copy_src); i++)
+      g_copy_src[i] = (uint8_t)(i * 7 + 3);
+  memset(g_copy_dst, 0, sizeof(g_copy_dst));
+}
+
+/* Copy with the given buffer offsets and check the result against the source */
+static uint32_t
+host_copy_run(const char *name, void *(*copy)(void *, void *, size_t),
+              uint32_t dst_off, uint32_t src_off, uint32_t iters)
+{
+  uint32_t i;
+
+  for (i = 0; i < iters; i++) {
+      copy(g_copy_dst + dst_off, g_copy_src + src_off, HOST_COPY_SIZE);
+      g_sink += g_copy_dst[dst_off + (i % HOST_COPY_SIZE)];
+  }
+
+  if (memcmp(g_copy_dst + dst_off, g_copy_src + src_off, HOST_COPY_SIZE) ||
+      (dst_off && g_copy_dst[dst_off - 1]) || g_copy_dst[dst_off + HOST_COPY_SIZE]) {
+      printf("%s: copy mismatch\n", name);
+      return 0;
+  }
+  return iters;
+}
+
+static uint32_t
+bench_memcpy_aligned(uint32_t iters)
+{
+  return host_copy_run("memcpy_aligned", val_memcpy, 0, 0, iters);
+}
+
+static uint32_t
+bench_memcpy_offset(uint32_t iters)
+{
+  return host_copy_run("memcpy_offset", val_memcpy, 3, 3, iters);
+}
+
+static uint32_t
+bench_memcpy_mismatched(uint32_t iters)
+{
+  return host_copy_run("memcpy_mismatched", val_memcpy, 1, 4, iters);
+}
+
+static uint32_t
+bench_memcpy_io(uint32_t iters)
+{
+  return host_copy_run("memcpy_io", val_memcpy_io, 0, 0, iters);
+}
+
+static uint32_t
+bench_memory_set(uint32_t iters)
+{
+  uint32_t i;
+
+  for (i = 0; i < iters; i++) {
+      val_memory_set(g_copy_dst + 1, HOST_COPY_SIZE, (uint8_t)(i | 1));
+      g_sink += g_copy_dst[1 + (i % HOST_COPY_SIZE)];
+  }
+
+  for (i = 1; i <= HOST_COPY_SIZE; i++) {
+      if (g_copy_dst[i] != (uint8_t)((iters - 1) | 1)) {
+          printf("memory_set: byte %u is 0x%x\n", i - 1, g_copy_dst[i]);
+          return 0;
+      }
+  }
+  if (g_copy_dst[0] || g_copy_dst[HOST_COPY_SIZE + 1])
+      return 0;
+
+  return iters;
+}
+
+static const HOST_BENCH g_benches[] = {
+  {"pcie_create_info_table",     bench_pcie_create_prepare,   bench_pcie_create},
+  {"pcie_read_cfg",              NULL,                        bench_pcie_read_cfg},
+  {"pcie_find_capability",       NULL,                        bench_pcie_find_capability},
+  {"pcie_get_rootport",          NULL,                        bench_pcie_get_rootport},
+  {"iovirt_create_info_table",   bench_iovirt_create_prepare, bench_iovirt_create},
+  {"iovirt_get_device_info",     NULL,                        bench_iovirt_get_device_info},
+  {"iovirt_get_rc_smmu_index",   NULL,                        bench_iovirt_get_rc_smmu_index},
+  {"pe_create_info_table",       bench_pe_create_prepare,     bench_pe_create},
+  {"pe_get_index_mpid",          NULL,                        bench_pe_get_index_mpid},
+  {"print_suppressed",           NULL,                        bench_print_suppressed},
+  {"print_emitted",              NULL,                        bench_print_emitted},
+  {"memcpy_aligned",             bench_copy_prepare,          bench_memcpy_aligned},
+  {"memcpy_offset",              bench_copy_prepare,          bench_memcpy_offset},
+  {"memcpy_mismatched",          bench_copy_prepare,          bench_memcpy_mismatched},
+  {"memcpy_io",                  bench_copy_prepare,          bench_memcpy_io},
+  {"memory_set",                 bench_copy_prepare,          bench_memory_set},
+};
+
+/**
+  @brief  Run one benchmark g_reps times and print the best and mean time
+
+  @return 0 on success, 1 if any repetition reported a failure
+**/
+static uint32_t
+host_run_bench(const HOST_BENCH *bench, const char *filter)
+{
+  uint64_t start, elapsed, best = ~0ULL, total = 0;
+  uint32_t rep, ops = 0;
+
+  if (filter && !strstr(bench->name, filter))
+      return 0;
+
+  for (rep = 0; rep < g_reps; rep++) {
+      if (bench->prepare)
+          bench->prepare();
+
+      start = host_now_ns();
+      ops = bench->run(g_iters);
+      elapsed = host_now_ns() - start;
+
+      if (ops == 0) {
+          printf("%-28s FAILED\n", bench->name);
+          return 1;
+      }
+
+      total += elapsed;
+      if (elapsed < best)
+          best = elapsed;
+  }
+
+  printf("%-28s %10u %14.1f %14.1f %12.1f\n", bench->name, ops,
+         best / 1000.0, (total / g_reps) / 1000.0, (double)best / ops);
+  return 0;
+}
+
+static void
+host_usage(const char *prog)
+{
+  printf("Usage: %s [options] [benchmark-filter]\n"
+         "  --bdfs N      PCIe functions, root ports included (default 1000, max %zu)\n"
+         "  --segments N  PCIe segments (default 4, max %u)\n"
+         "  --pes N       PEs (default 1024)\n"
+         "  --smmus N     SMMUv3 nodes (default 8)\n"
+         "  --iters N     lookups, copies or fills per repetition (default 20000)\n"
+         "  --reps N      repetitions, best and mean reported (default 5)\n"
+         "  --verbose     print VAL INFO messages and write the console sink to stdout\n",
+         prog, HOST_BDF_TABLE_CAPACITY, HOST_MAX_SEGMENTS);
+}
+
+int
+main(int argc, char **argv)
+{
+  HOST_TOPOLOGY_CFG cfg = {.num_bdfs = 1000, .num_segments = 4, .num_pes = 1024,
+                           .num_smmus = 8};
+  const char *filter = NULL;
+  uint32_t verbose = 0, failed = 0, i;
+  int arg;
+
+  for (arg = 1; arg < argc; arg++) {
+      if (!strcmp(argv[arg], "--verbose")) {
+          verbose = 1;
+      } else if (!strcmp(argv[arg], "--help") || !strcmp(argv[arg], "-h")) {
+          host_usage(argv[0]);
+          return 0;
+      } else if ((arg + 1 < argc) && !strncmp(argv[arg], "--", 2)) {
+          uint32_t value = (uint32_t)strtoul(argv[arg + 1], NULL, 0);
+
+          if (!strcmp(argv[arg], "--bdfs"))
+              cfg.num_bdfs = value;
+          else if (!strcmp(argv[arg], "--segments"))
+              cfg.num_segments = value;
+          else if (!strcmp(argv[arg], "--pes"))
+              cfg.num_pes = value;
+          else if (!strcmp(argv[arg], "--smmus"))
+              cfg.num_smmus = value;
+          else if (!strcmp(argv[arg], "--iters"))
+              g_iters = value;
+          else if (!strcmp(argv[arg], "--reps"))
+              g_reps = value;
+          else {
+              host_usage(argv[0]);
+              return 1;
+          }
+          arg++;
+      } else if (argv[arg][0] != '-') {
+          filter = argv[arg];
+      } else {
+          host_usage(argv[0]);
+          return 1;
+      }
+  }
+
+  /* The VAL BDF table is a fixed PCIE_DEVICE_BDF_TABLE_SZ allocation */
+  if ((cfg.num_bdfs < 2) || (cfg.num_bdfs > HOST_BDF_TABLE_CAPACITY)) {
+      printf("--bdfs must be 2..%zu (PCIE_DEVICE_BDF_TABLE_SZ)\n", HOST_BDF_TABLE_CAPACITY);
+      return 1;
+  }
+
+  if ((g_iters == 0) || (g_reps == 0) || host_topology_build(&cfg)) {
+      printf("Unsupported topology: bdfs %u segments %u pes %u smmus %u\n",
+             cfg.num_bdfs, cfg.num_segments, cfg.num_pes, cfg.num_smmus);
+      return 1;
+  }
+
+  acs_reset_execution_policy();
+  acs_get_execution_policy_mut()->print_level = verbose ? INFO : ERROR;
+  host_print_enable(verbose);
+
+  printf("Topology: %u BDFs (%u RPs, %u EPs) in %u segments, %u PEs, %u SMMUs\n",
+         cfg.num_bdfs, host_pcie_num_rootports(), host_pcie_num_endpoints(),
+         cfg.num_segments, cfg.num_pes, cfg.num_smmus);
+  printf("%-28s %10s %14s %14s %12s\n", "benchmark", "ops", "best(us)", "mean(us)", "ns/op");
+
+  /* Lookups run against tables built once up front, so any filter works */
+  bench_pcie_create_prepare();
+  bench_iovirt_create_prepare();
+  bench_pe_create_prepare();
+  if (!bench_pcie_create(1) || !bench_iovirt_create(1) || !bench_pe_create(1)) {
+      printf("Info table creation failed\n");
+      return 1;
+  }
+
+  for (i = 0; i < sizeof(g_benches) / sizeof(g_benches[0]); i++)
+      failed |= host_run_bench(&g_benches[i], filter);
+
+  host_topology_free();
+  return failed;
+}
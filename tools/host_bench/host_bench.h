@@ -0,0 +1,69 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+#ifndef __HOST_BENCH_H__
+#define __HOST_BENCH_H__
+
+#include "pal_interface.h"
+
+/*
+ * Synthetic MMIO windows. pal_mmio_read/write decode addresses in these
+ * windows against the synthetic platform; any other address is host memory.
+ */
+#define HOST_ECAM_WINDOW       0xF000000000000000ULL
+#define HOST_ECAM_SEG_SIZE     0x10000000ULL          /* 256 buses x 1 MB */
+#define HOST_SMMU_WINDOW       0xF800000000000000ULL
+#define HOST_SMMU_SIZE         0x100000ULL
+#define HOST_MMIO_WINDOW_END   0xFC00000000000000ULL
+
+#define HOST_MAX_SEGMENTS      16
+#define HOST_EP_PER_RP         8                      /* functions 0-7 of device 0 */
+#define HOST_RP_PER_SEGMENT    255                    /* one secondary bus each */
+#define HOST_ITS_ID            0
+
+/* Synthetic config space identity */
+#define HOST_VENDOR_ID         0x13B5
+#define HOST_RP_DEVICE_ID      0x0DEF
+#define HOST_EP_DEVICE_ID      0x0ED0
+
+/**
+  @brief  Shape of the synthetic platform built by host_topology_build()
+**/
+typedef struct {
+  uint32_t num_bdfs;      ///< Root ports plus endpoints across all segments
+  uint32_t num_segments;  ///< PCIe segments (one ECAM region and one IORT RC node each)
+  uint32_t num_pes;       ///< PEs in the synthetic MADT
+  uint32_t num_smmus;     ///< SMMUv3 nodes; root ports are spread round robin across them
+} HOST_TOPOLOGY_CFG;
+
+uint32_t host_topology_build(const HOST_TOPOLOGY_CFG *cfg);
+void     host_topology_free(void);
+const HOST_TOPOLOGY_CFG *host_topology_cfg(void);
+
+uint32_t host_pcie_num_rootports(void);
+uint32_t host_pcie_endpoint_bdf(uint32_t index);
+uint32_t host_pcie_num_endpoints(void);
+uint64_t host_pe_mpidr(uint32_t index);
+
+uint32_t host_pcie_info_table_size(void);
+uint32_t host_pe_info_table_size(void);
+uint32_t host_iovirt_info_table_size(void);
+
+void     host_print_enable(uint32_t enable);
+uint64_t host_print_bytes(void);
+
+#endif /* __HOST_BENCH_H__ */
@@ -0,0 +1,627 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+/*
+ * Synthetic PAL for the host benchmark harness.
+ *
+ * The baremetal and UEFI PALs turn MCFG/MADT/IORT (or the DT) into the PAL
+ * info tables; VAL only ever sees those tables and ECAM reads. This PAL
+ * builds the same tables from a HOST_TOPOLOGY_CFG and backs ECAM with a
+ * sparse array of 4 KB config spaces, so VAL runs unmodified on the host.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_bench.h"
+#include "acs_pcie_spec.h"
+#include "acs_pcie.h"
+#include "val_interface.h"
+
+#define HOST_FUNCS_PER_SEGMENT  (256 * 32 * 8)
+#define HOST_CFG_SPACE_SIZE     0x1000
+#define HOST_PCIE_CAP_OFFSET    0x40
+#define HOST_PCIE_CAP_VERSION   0x2
+#define HOST_DP_TYPE_EP         0x0
+#define HOST_DP_TYPE_RP         0x4
+
+static struct {
+  HOST_TOPOLOGY_CFG cfg;
+  uint32_t          num_rp[HOST_MAX_SEGMENTS];
+  uint32_t          num_rp_total;
+  uint32_t          *ep_bdf;
+  uint32_t          num_ep;
+  uint32_t          print_enable;
+  uint64_t          print_bytes;
+} g_host;
+
+/* Config spaces are allocated in chunks of 1024 functions (four buses) */
+static uint8_t **g_cfg_chunk[HOST_MAX_SEGMENTS][HOST_FUNCS_PER_SEGMENT / 1024];
+
+/**
+  @brief  Return the config space backing seg/function index, NULL if absent
+**/
+static uint32_t *
+host_cfg_space(uint32_t seg, uint32_t fn_index)
+{
+  uint8_t **chunk = g_cfg_chunk[seg][fn_index >> 10];
+
+  if (chunk == NULL)
+      return NULL;
+
+  return (uint32_t *)chunk[fn_index & 0x3FF];
+}
+
+/**
+  @brief  Populate the config header of one synthetic function
+
+  @param  seg, bus, dev, func - location of the function
+  @param  dp_type             - PCIe device/port type (HOST_DP_TYPE_*)
+  @param  sec_bus             - secondary bus for a root port, ignored for endpoints
+
+  @return 0 on success, 1 on allocation failure
+**/
+static uint32_t
+host_add_function(uint32_t seg, uint32_t bus, uint32_t dev, uint32_t func,
+                  uint32_t dp_type, uint32_t sec_bus)
+{
+  uint32_t fn_index = (bus << 8) | (dev << 3) | func;
+  uint8_t  ***chunk = &g_cfg_chunk[seg][fn_index >> 10];
+  uint32_t *cfg;
+
+  if (*chunk == NULL) {
+      *chunk = calloc(1024, sizeof(uint8_t *));
+      if (*chunk == NULL)
+          return 1;
+  }
+
+  cfg = calloc(1, HOST_CFG_SPACE_SIZE);
+  if (cfg == NULL)
+      return 1;
+  (*chunk)[fn_index & 0x3FF] = (uint8_t *)cfg;
+
+  /* Capabilities List bit in the Status register */
+  cfg[TYPE01_CR / 4] = (1u << 20);
+  cfg[TYPE01_CPR / 4] = HOST_PCIE_CAP_OFFSET;
+  cfg[HOST_PCIE_CAP_OFFSET / 4] = CID_PCIECS |
+                                  ((HOST_PCIE_CAP_VERSION | (dp_type << 4)) << 16);
+
+  if (dp_type == HOST_DP_TYPE_RP) {
+      cfg[TYPE01_VIDR / 4] = (HOST_RP_DEVICE_ID << 16) | HOST_VENDOR_ID;
+      cfg[TYPE01_RIDR / 4] = (0x060400u << 8) | 0x1;                /* PCI-PCI bridge */
+      cfg[TYPE01_CLSR / 4] = (uint32_t)(TYPE1_HEADER | (func ? 0 : 0x80)) << 16;
+      cfg[TYPE1_PBN / 4]   = (sec_bus << 16) | (sec_bus << 8) | bus;
+  } else {
+      cfg[TYPE01_VIDR / 4] = (HOST_EP_DEVICE_ID << 16) | HOST_VENDOR_ID;
+      cfg[TYPE01_RIDR / 4] = (0x120000u << 8) | 0x1;                /* accelerator */
+      cfg[TYPE01_CLSR / 4] = (uint32_t)(TYPE0_HEADER | (func ? 0 : 0x80)) << 16;
+  }
+
+  return 0;
+}
+
+/**
+  @brief  Build the synthetic platform described by cfg
+
+  Root ports sit on bus 0 of each segment (device r / 8, function r % 8) and
+  own secondary bus r + 1, which carries up to HOST_EP_PER_RP endpoint
+  functions. Root ports are dealt round robin across segments until
+  num_bdfs functions exist.
+
+  @param  cfg - requested topology
+  @return 0 on success, 1 if cfg is out of range or memory ran out
+**/
+uint32_t
+host_topology_build(const HOST_TOPOLOGY_CFG *cfg)
+{
+  uint32_t remaining, seg, rp, sec_bus, ep, count;
+
+  host_topology_free();
+
+  if ((cfg->num_segments == 0) || (cfg->num_segments > HOST_MAX_SEGMENTS) ||
+      (cfg->num_pes == 0) || (cfg->num_smmus == 0))
+      return 1;
+
+  g_host.cfg = *cfg;
+  g_host.ep_bdf = calloc(cfg->num_bdfs + 1, sizeof(uint32_t));
+  if (g_host.ep_bdf == NULL)
+      return 1;
+
+  remaining = cfg->num_bdfs;
+  while (remaining) {
+      seg = g_host.num_rp_total % cfg->num_segments;
+      rp  = g_host.num_rp[seg];
+      if (rp >= HOST_RP_PER_SEGMENT)
+          return 1;
+      sec_bus = rp + 1;
+
+      if (host_add_function(seg, 0, rp / 8, rp % 8, HOST_DP_TYPE_RP, sec_bus))
+          return 1;
+      remaining--;
+
+      count = (remaining < HOST_EP_PER_RP) ? remaining : HOST_EP_PER_RP;
+      for (ep = 0; ep < count; ep++) {
+          if (host_add_function(seg, sec_bus, 0, ep, HOST_DP_TYPE_EP, 0))
+              return 1;
+          g_host.ep_bdf[g_host.num_ep++] = PCIE_CREATE_BDF(seg, sec_bus, 0, ep);
+      }
+      remaining -= count;
+
+      g_host.num_rp[seg]++;
+      g_host.num_rp_total++;
+  }
+
+  return 0;
+}
+
+/**
+  @brief  Release all synthetic config spaces
+**/
+void
+host_topology_free(void)
+{
+  uint32_t seg, chunk, fn;
+
+  for (seg = 0; seg < HOST_MAX_SEGMENTS; seg++) {
+      for (chunk = 0; chunk < HOST_FUNCS_PER_SEGMENT / 1024; chunk++) {
+          if (g_cfg_chunk[seg][chunk] == NULL)
+              continue;
+          for (fn = 0; fn < 1024; fn++)
+              free(g_cfg_chunk[seg][chunk][fn]);
+          free(g_cfg_chunk[seg][chunk]);
+          g_cfg_chunk[seg][chunk] = NULL;
+      }
+  }
+
+  free(g_host.ep_bdf);
+  memset(&g_host.cfg, 0, sizeof(g_host.cfg));
+  memset(g_host.num_rp, 0, sizeof(g_host.num_rp));
+  g_host.ep_bdf = NULL;
+  g_host.num_ep = 0;
+  g_host.num_rp_total = 0;
+}
+
+const HOST_TOPOLOGY_CFG *
+host_topology_cfg(void)
+{
+  return &g_host.cfg;
+}
+
+uint32_t
+host_pcie_num_rootports(void)
+{
+  return g_host.num_rp_total;
+}
+
+uint32_t
+host_pcie_num_endpoints(void)
+{
+  return g_host.num_ep;
+}
+
+uint32_t
+host_pcie_endpoint_bdf(uint32_t index)
+{
+  return g_host.ep_bdf[index % g_host.num_ep];
+}
+
+/**
+  @brief  MPIDR of PE index: 256 PEs per cluster in Aff1, clusters in Aff2
+**/
+uint64_t
+host_pe_mpidr(uint32_t index)
+{
+  return ((uint64_t)((index >> 8) & 0xFF) << 16) | ((uint64_t)(index & 0xFF) << 8);
+}
+
+uint32_t
+host_pcie_info_table_size(void)
+{
+  return sizeof(PCIE_INFO_TABLE) + g_host.cfg.num_segments * sizeof(PCIE_INFO_BLOCK);
+}
+
+uint32_t
+host_pe_info_table_size(void)
+{
+  return sizeof(PE_INFO_TABLE) + g_host.cfg.num_pes * sizeof(PE_INFO_ENTRY);
+}
+
+uint32_t
+host_iovirt_info_table_size(void)
+{
+  uint32_t blocks = 1 + g_host.cfg.num_smmus + g_host.cfg.num_segments;
+  uint32_t maps = 1 + g_host.cfg.num_smmus + g_host.cfg.num_segments + g_host.num_rp_total;
+
+  return sizeof(IOVIRT_INFO_TABLE) + blocks * sizeof(IOVIRT_BLOCK) +
+         maps * sizeof(NODE_DATA_MAP);
+}
+
+void
+host_print_enable(uint32_t enable)
+{
+  g_host.print_enable = enable;
+}
+
+uint64_t
+host_print_bytes(void)
+{
+  return g_host.print_bytes;
+}
+
+/* ------------------------------------------------------------------------ */
+/* PAL: memory and MMIO                                                     */
+/* ------------------------------------------------------------------------ */
+
+void *
+pal_aligned_alloc(uint32_t alignment, uint32_t size)
+{
+  void *ptr;
+
+  if (alignment < sizeof(void *))
+      alignment = sizeof(void *);
+
+  if (posix_memalign(&ptr, alignment, size))
+      return NULL;
+
+  return ptr;
+}
+
+void
+pal_mem_free_aligned(void *buffer)
+{
+  free(buffer);
+}
+
+uint32_t
+pal_mmio_read(uint64_t addr)
+{
+  uint64_t offset;
+  uint32_t *cfg;
+
+  if ((addr >= HOST_ECAM_WINDOW) &&
+      (addr < HOST_ECAM_WINDOW + HOST_MAX_SEGMENTS * HOST_ECAM_SEG_SIZE)) {
+      offset = addr - HOST_ECAM_WINDOW;
+      cfg = host_cfg_space(offset / HOST_ECAM_SEG_SIZE,
+                           (offset % HOST_ECAM_SEG_SIZE) >> 12);
+      if (cfg == NULL)
+          return PCIE_UNKNOWN_RESPONSE;
+      return cfg[(offset & 0xFFC) / 4];
+  }
+
+  /* SMMU and other synthetic registers read as zero */
+  if ((addr >= HOST_SMMU_WINDOW) && (addr < HOST_MMIO_WINDOW_END))
+      return 0;
+
+  return *(volatile uint32_t *)(uintptr_t)addr;
+}
+
+void
+pal_mmio_write(uint64_t addr, uint32_t data)
+{
+  uint64_t offset;
+  uint32_t *cfg;
+
+  if ((addr >= HOST_ECAM_WINDOW) &&
+      (addr < HOST_ECAM_WINDOW + HOST_MAX_SEGMENTS * HOST_ECAM_SEG_SIZE)) {
+      offset = addr - HOST_ECAM_WINDOW;
+      cfg = host_cfg_space(offset / HOST_ECAM_SEG_SIZE,
+                           (offset % HOST_ECAM_SEG_SIZE) >> 12);
+      if (cfg != NULL)
+          cfg[(offset & 0xFFC) / 4] = data;
+      return;
+  }
+
+  if ((addr >= HOST_SMMU_WINDOW) && (addr < HOST_MMIO_WINDOW_END))
+      return;
+
+  *(volatile uint32_t *)(uintptr_t)addr = data;
+}
+
+/**
+  @brief  Console sink. Output is counted always and written only when enabled,
+          so logger benchmarks measure formatting rather than the terminal.
+**/
+void
+pal_print(uint64_t data)
+{
+  const char *str = (const char *)(uintptr_t)data;
+
+  g_host.print_bytes += strlen(str);
+  if (g_host.print_enable)
+      fputs(str, stdout);
+}
+
+/* ------------------------------------------------------------------------ */
+/* PAL: info tables                                                         */
+/* ------------------------------------------------------------------------ */
+
+void
+pal_pcie_create_info_table(PCIE_INFO_TABLE *PcieTable)
+{
+  uint32_t seg;
+
+  PcieTable->num_entries = g_host.cfg.num_segments;
+  for (seg = 0; seg < g_host.cfg.num_segments; seg++) {
+      PcieTable->block[seg].ecam_base = HOST_ECAM_WINDOW + seg * HOST_ECAM_SEG_SIZE;
+      PcieTable->block[seg].segment_num = seg;
+      PcieTable->block[seg].start_bus_num = 0;
+      PcieTable->block[seg].end_bus_num = 255;
+  }
+}
+
+void
+pal_pe_create_info_table(PE_INFO_TABLE *PeTable)
+{
+  uint32_t i;
+
+  PeTable->header.num_of_pe = g_host.cfg.num_pes;
+  for (i = 0; i < g_host.cfg.num_pes; i++) {
+      memset(&PeTable->pe_info[i], 0, sizeof(PE_INFO_ENTRY));
+      PeTable->pe_info[i].pe_num = i;
+      PeTable->pe_info[i].mpidr = host_pe_mpidr(i);
+      PeTable->pe_info[i].pmu_gsiv = 23;
+      PeTable->pe_info[i].gmain_gsiv = 25;
+      PeTable->pe_info[i].acpi_proc_uid = i;
+  }
+}
+
+/**
+  @brief  Build an IORT-equivalent table: one ITS group, num_smmus SMMUv3
+          nodes mapping all stream ids to the ITS group, and one root complex
+          node per segment with an ID mapping per root port bus range.
+**/
+void
+pal_iovirt_create_info_table(IOVIRT_INFO_TABLE *IoVirtTable)
+{
+  IOVIRT_BLOCK *block, *its;
+  uint32_t *smmu_off;
+  uint32_t i, seg, rp, rp_global;
+
+  smmu_off = calloc(g_host.cfg.num_smmus, sizeof(uint32_t));
+  if (smmu_off == NULL)
+      return;
+
+  memset(IoVirtTable, 0, sizeof(IOVIRT_INFO_TABLE));
+  block = &IoVirtTable->blocks[0];
+
+  its = block;
+  memset(its, 0, sizeof(IOVIRT_BLOCK) + sizeof(NODE_DATA_MAP));
+  its->type = IOVIRT_NODE_ITS_GROUP;
+  its->num_data_map = 1;
+  its->data.its_count = 1;
+  its->data_map[0].id[0] = HOST_ITS_ID;
+  IoVirtTable->num_its_groups = 1;
+  IoVirtTable->num_blocks++;
+  block = IOVIRT_NEXT_BLOCK(block);
+
+  for (i = 0; i < g_host.cfg.num_smmus; i++) {
+      memset(block, 0, sizeof(IOVIRT_BLOCK) + sizeof(NODE_DATA_MAP));
+      block->type = IOVIRT_NODE_SMMU_V3;
+      block->num_data_map = 1;
+      block->data.smmu.arch_major_rev = 3;
+      block->data.smmu.base = HOST_SMMU_WINDOW + i * HOST_SMMU_SIZE;
+      block->data_map[0].map.input_base = 0;
+      block->data_map[0].map.id_count = 0x00FFFFFF;
+      block->data_map[0].map.output_base = 0;
+      block->data_map[0].map.output_ref = (uint8_t *)its - (uint8_t *)IoVirtTable;
+      smmu_off[i] = (uint8_t *)block - (uint8_t *)IoVirtTable;
+      IoVirtTable->num_smmus++;
+      IoVirtTable->num_blocks++;
+      block = IOVIRT_NEXT_BLOCK(block);
+  }
+
+  for (seg = 0; seg < g_host.cfg.num_segments; seg++) {
+      memset(block, 0, sizeof(IOVIRT_BLOCK) + (1 + g_host.num_rp[seg]) * sizeof(NODE_DATA_MAP));
+      block->type = IOVIRT_NODE_PCI_ROOT_COMPLEX;
+      block->num_data_map = 1 + g_host.num_rp[seg];
+      block->data.rc.segment = seg;
+      block->data.rc.cca = 1;
+      block->data.rc.smmu_base = HOST_SMMU_WINDOW + (seg % g_host.cfg.num_smmus) * HOST_SMMU_SIZE;
+
+      /* Bus 0 (the root ports themselves), then one map per secondary bus */
+      block->data_map[0].map.input_base = 0;
+      block->data_map[0].map.id_count = 0xFF;
+      block->data_map[0].map.output_base = seg << 16;
+      block->data_map[0].map.output_ref = smmu_off[seg % g_host.cfg.num_smmus];
+
+      for (rp = 0; rp < g_host.num_rp[seg]; rp++) {
+          rp_global = rp * g_host.cfg.num_segments + seg;
+          block->data_map[1 + rp].map.input_base = (rp + 1) << 8;
+          block->data_map[1 + rp].map.id_count = 0xFF;
+          block->data_map[1 + rp].map.output_base = (seg << 16) | ((rp + 1) << 8);
+          block->data_map[1 + rp].map.output_ref = smmu_off[rp_global % g_host.cfg.num_smmus];
+      }
+
+      IoVirtTable->num_pci_rcs++;
+      IoVirtTable->num_blocks++;
+      block = IOVIRT_NEXT_BLOCK(block);
+  }
+
+  free(smmu_off);
+}
+
+/**
+  @brief  Same walk as the baremetal PAL: RC node ID map, then the SMMU it
+          references
+**/
+uint64_t
+pal_iovirt_get_rc_smmu_base(IOVIRT_INFO_TABLE *Iovirt, uint32_t RcSegmentNum, uint32_t rid)
+{
+  IOVIRT_BLOCK *block = &Iovirt->blocks[0];
+  NODE_DATA_MAP *map;
+  uint32_t i, j, oref = 0, mapping_found = 0;
+
+  for (i = 0; i < Iovirt->num_blocks; i++, block = IOVIRT_NEXT_BLOCK(block)) {
+      if ((block->type != IOVIRT_NODE_PCI_ROOT_COMPLEX) ||
+          (block->data.rc.segment != RcSegmentNum))
+          continue;
+      for (j = 0, map = &block->data_map[0]; j < block->num_data_map; j++, map++) {
+          if ((rid >= map->map.input_base) &&
+              (rid <= map->map.input_base + map->map.id_count)) {
+              oref = map->map.output_ref;
+              mapping_found = 1;
+              break;
+          }
+      }
+  }
+
+  if (!mapping_found)
+      return 0xFFFFFFFF;
+
+  block = (IOVIRT_BLOCK *)((uint8_t *)Iovirt + oref);
+  if ((block->type == IOVIRT_NODE_SMMU) || (block->type == IOVIRT_NODE_SMMU_V3))
+      return block->data.smmu.base;
+
+  return 0;
+}
+
+int32_t
+pal_psci_get_conduit(void)
+{
+  return CONDUIT_SMC;
+}
+
+uint32_t
+pal_get_pe_count(void)
+{
+  return g_host.cfg.num_pes;
+}
+
+uint64_t *
+pal_get_phy_mpidr_list_base(void)
+{
+  return NULL;
+}
+
+uint32_t
+pal_target_is_bm(void)
+{
+  return 1;
+}
+
+uint32_t
+pal_target_is_dt(void)
+{
+  return 0;
+}
+
+/* ------------------------------------------------------------------------ */
+/* PAL: hooks VAL links against but the benchmarks do not exercise          */
+/* ------------------------------------------------------------------------ */
+
+uint32_t pal_bsa_pcie_enumerate(void) { return 0; }
+void     pal_pcie_enumerate(void) { }
+uint32_t pal_pcie_check_device_list(void) { return 0; }
+uint32_t pal_pcie_check_device_valid(uint32_t bdf) { return 0; }
+uint32_t pal_pcie_check_bus_valid(uint32_t bus_index) { return 0; }
+uint32_t pal_pcie_is_onchip_peripheral(uint32_t bdf) { return 0; }
+uint32_t pal_pcie_p2p_support(void) { return NOT_IMPLEMENTED; }
+uint32_t pal_pcie_dsm_ste_tags(void) { return 0; }
+uint32_t pal_pcie_io_read_cfg(uint32_t bdf, uint32_t offset, uint32_t *data) { return 1; }
+void     pal_pcie_io_write_cfg(uint32_t bdf, uint32_t offset, uint32_t data) { }
+uint32_t pal_pcie_mem_get_offset(uint32_t bdf, PCIE_MEM_TYPE_INFO_e mem_type) { return 0; }
+uint32_t pal_pcie_bar_mem_read(uint32_t bdf, uint64_t address, uint32_t *data) { return 1; }
+uint32_t pal_pcie_bar_mem_write(uint32_t bdf, uint64_t address, uint32_t data) { return 1; }
+
+uint32_t
+pal_pcie_dev_p2p_support(uint32_t seg, uint32_t bus, uint32_t dev, uint32_t fn)
+{
+  return NOT_IMPLEMENTED;
+}
+
+uint32_t
+pal_pcie_is_cache_present(uint32_t seg, uint32_t bus, uint32_t dev, uint32_t fn)
+{
+  return 0;
+}
+
+uint32_t
+pal_pcie_device_driver_present(uint32_t seg, uint32_t bus, uint32_t dev, uint32_t fn)
+{
+  return 1;
+}
+
+uint32_t
+pal_pcie_is_devicedma_64bit(uint32_t seg, uint32_t bus, uint32_t dev, uint32_t fn)
+{
+  return 1;
+}
+
+uint32_t
+pal_pcie_is_device_behind_smmu(uint32_t seg, uint32_t bus, uint32_t dev, uint32_t fn)
+{
+  return 1;
+}
+
+uint32_t
+pal_pcie_get_rp_transaction_frwd_support(uint32_t seg, uint32_t bus, uint32_t dev, uint32_t fn)
+{
+  return 1;
+}
+
+uint32_t
+pal_pcie_get_legacy_irq_map(uint32_t seg, uint32_t bus, uint32_t dev, uint32_t fn,
+                            PERIPHERAL_IRQ_MAP *irq_map)
+{
+  return 1;
+}
+
+uint32_t
+pal_get_msi_vectors(uint32_t seg, uint32_t bus, uint32_t dev, uint32_t fn,
+                    PERIPHERAL_VECTOR_LIST **mvector)
+{
+  return 0;
+}
+
+uint32_t pal_is_bdf_exerciser(uint32_t bdf) { return 0; }
+
+uint32_t
+pal_exerciser_get_data(EXERCISER_DATA_TYPE type, exerciser_data_t *data, uint32_t bdf,
+                       uint64_t ecam)
+{
+  return NOT_IMPLEMENTED;
+}
+
+uint32_t pal_iovirt_check_unique_ctx_intid(uint64_t smmu_block) { return 1; }
+
+uint32_t
+pal_get_device_path(const char *hid, char hid_path[][MAX_NAMED_COMP_LENGTH])
+{
+  return 1;
+}
+
+uint32_t pal_smmu_is_etr_behind_catu(char *etr_path) { return 0; }
+uint32_t pal_smmu_check_device_iova(void *port, uint64_t dma_addr) { return 0; }
+void     pal_smmu_device_start_monitor_iova(void *port) { }
+void     pal_smmu_device_stop_monitor_iova(void *port) { }
+
+uint64_t
+pal_smmu_pa2iova(uint64_t smmu_base, uint64_t pa, uint64_t *dram_buf_iova)
+{
+  return NOT_IMPLEMENTED;
+}
+
+void pal_smbios_create_info_table(PE_SMBIOS_PROCESSOR_INFO_TABLE *SmbiosTable) { }
+void pal_pe_call_smc(ARM_SMC_ARGS *args, int32_t conduit) { }
+void pal_pe_execute_payload(ARM_SMC_ARGS *args) { }
+
+uint32_t
+pal_pe_install_esr(uint32_t exception_type, void (*esr)(uint64_t, void *))
+{
+  return 0;
+}
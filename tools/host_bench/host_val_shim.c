@@ -0,0 +1,110 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+/*
+ * Host versions of the VAL entry points that live in translation units the
+ * harness cannot build (system register access, cache maintenance, MMU and
+ * exception handling, test status reporting). Each one does the minimum the
+ * benchmarked table paths need and nothing else.
+ */
+
+#include "host_bench.h"
+#include "acs_val.h"
+#include "acs_common.h"
+#include "acs_pe.h"
+#include "acs_memory.h"
+#include "acs_mmu.h"
+#include "acs_cfg.h"
+#include "val_interface.h"
+
+/* The deferred logger stores format offsets relative to the image .rodata */
+char __RODATA_START__[1];
+char __RODATA_END__[1];
+
+uint64_t g_stack_pointer;
+uint64_t g_exception_ret_addr;
+uint64_t g_ret_addr;
+
+/* Neoverse N2 r0p0, matching the RDN2 FVP */
+#define HOST_MIDR  0x410FD490ULL
+
+uint64_t
+val_pe_reg_read(uint32_t reg_id)
+{
+  switch (reg_id) {
+  case MPIDR_EL1:
+      return host_pe_mpidr(0) | (1ULL << 31);
+  case MIDR_EL1:
+      return HOST_MIDR;
+  default:
+      return 0;
+  }
+}
+
+uint32_t
+val_mmio_read(addr_t addr)
+{
+  return pal_mmio_read(addr);
+}
+
+void *
+val_aligned_alloc(uint32_t alignment, uint32_t size)
+{
+  return pal_aligned_alloc(alignment, size);
+}
+
+/* Host caches are coherent; maintenance and barriers are no-ops */
+void val_data_cache_ops_by_va(addr_t addr, uint32_t type) { }
+void val_mem_issue_dsb(void) { }
+
+uint32_t
+val_mmu_update_entry(uint64_t address, uint32_t size, uint64_t attr)
+{
+  return 0;
+}
+
+uint64_t
+val_smmu_get_info(SMMU_INFO_e type, uint32_t index)
+{
+  return val_iovirt_get_smmu_info(type, index);
+}
+
+uint64_t val_dma_get_info(DMA_INFO_e type, uint32_t index) { return 0; }
+uint64_t val_peripheral_get_info(PERIPHERAL_INFO_e info_type, uint32_t index) { return 0; }
+
+void val_set_status(uint32_t index, uint32_t status) { }
+void val_report_status(uint32_t id, uint32_t status, char8_t *ruleid) { }
+void val_set_test_data(uint32_t index, uint64_t addr, uint64_t test_data) { }
+
+void
+val_get_test_data(uint32_t index, uint64_t *data0, uint64_t *data1)
+{
+  *data0 = 0;
+  *data1 = 0;
+}
+
+uint32_t
+val_acs_install_esr(uint32_t exception_type, void (*esr)(uint64_t, void *))
+{
+  return 0;
+}
+
+uint64_t val_pe_get_esr(void *context) { return 0; }
+uint64_t val_pe_get_far(void *context) { return 0; }
+void     val_pe_update_elr(void *context, uint64_t offset) { }
+uint64_t bsa_gic_get_esr(void) { return 0; }
+uint64_t bsa_gic_get_far(void) { return 0; }
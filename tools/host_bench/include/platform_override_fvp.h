@@ -0,0 +1,27 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+/*
+ * Host harness overrides on top of the reference target configuration.
+ * The synthetic ECAM regions span the full bus range, so lift the FVP bus
+ * limit; everything else comes from the target header unchanged.
+ */
+
+#include_next "platform_override_fvp.h"
+
+#undef  PLATFORM_BM_OVERRIDE_PCIE_MAX_BUS
+#define PLATFORM_BM_OVERRIDE_PCIE_MAX_BUS      256
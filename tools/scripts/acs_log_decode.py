@@ -0,0 +1,254 @@
+## @file
+ # Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ # SPDX-License-Identifier : Apache-2.0
+ #
+ # Licensed under the Apache License, Version 2.0 (the "License");
+ # you may not use this file except in compliance with the License.
+ # You may obtain a copy of the License at
+ #
+ #  http://www.apache.org/licenses/LICENSE-2.0
+ #
+ # Unless required by applicable law or agreed to in writing, software
+ # distributed under the License is distributed on an "AS IS" BASIS,
+ # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ # See the License for the specific language governing permissions and
+ # limitations under the License.
+ ##
+
+"""Decode the deferred log printed by a baremetal ACS image.
+
+With PLATFORM_OVERRIDE_DEFERRED_LOG enabled, val_printf() stores every message
+as a binary record (see val/src/val_logger.c) and the image prints the buffer
+as ACS-DLOG lines after the run. This script rebuilds the text using the
+format strings from the .rodata section of the same ELF image.
+
+Usage:
+  python3 tools/scripts/acs_log_decode.py <image.elf> <console.log> [-o out.log]
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+REC_MAGIC = 0xD1
+REC_FMT_INLINE = 0x1
+REC_FMT_TRUNC = 0x2
+STRING_TRUNC = 1 << 63
+TRUNC_MARKER = "<truncated>"
+
+LEVEL_PREFIX = {1: "\t", 2: "\t", 3: "", 4: "\tWARN : ", 5: "\tERROR: ", 6: "\tFATAL: "}
+
+CONV_RE = re.compile(r"%([-+ #0]*)(\*|\d*)(hh|h|ll|l|j|z|t)?(.)", re.S)
+
+
+def read_rodata(elf_path):
+    """Return (address, bytes) of the .rodata section of an ELF64 image.
+
+    The image linker scripts place __RODATA_START__ at the start of .rodata,
+    which is what record format offsets are relative to.
+    """
+    with open(elf_path, "rb") as elf:
+        data = elf.read()
+
+    if data[:4] != b"\x7fELF" or data[4] != 2:
+        raise SystemExit(f"error: {elf_path} is not an ELF64 image")
+
+    shoff, = struct.unpack_from("<Q", data, 0x28)
+    shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x3A)
+
+    def section(index):
+        base = shoff + index * shentsize
+        name, _, _, addr, offset, size = struct.unpack_from("<IIQQQQ", data, base)
+        return name, addr, offset, size
+
+    _, _, str_off, _ = section(shstrndx)
+    for index in range(shnum):
+        name, addr, offset, size = section(index)
+        end = data.index(b"\0", str_off + name)
+        if data[str_off + name:end] == b".rodata":
+            return addr, data[offset:offset + size]
+
+    raise SystemExit(f"error: no .rodata section in {elf_path}")
+
+
+def read_dump(log_path):
+    """Return (rodata_base, used, dropped, payload) from ACS-DLOG lines."""
+    header = None
+    hex_parts = []
+    with open(log_path, "r", encoding="utf-8", errors="replace") as log:
+        for line in log:
+            line = line.strip()
+            if line.startswith("ACS-DLOG-BEGIN "):
+                header = [int(field, 16) for field in line.split()[1:4]]
+                hex_parts = []
+            elif line.startswith("ACS-DLOG ") and header is not None:
+                hex_parts.append(line.split()[1])
+
+    if header is None:
+        raise SystemExit(f"error: no ACS-DLOG-BEGIN marker in {log_path}")
+
+    payload = bytes.fromhex("".join(hex_parts))
+    rodata_base, used, dropped = header
+    if len(payload) < used:
+        print(f"warning: dump truncated, {len(payload)} of {used} bytes present",
+              file=sys.stderr)
+    return rodata_base, used, dropped, payload[:used]
+
+
+class Reader:
+    """Sequential reader over one record."""
+
+    def __init__(self, data, pos):
+        self.data = data
+        self.pos = pos
+
+    def u64(self):
+        value, = struct.unpack_from("<Q", self.data, self.pos)
+        self.pos += 8
+        return value
+
+    def string(self):
+        length = self.u64()
+        truncated = bool(length & STRING_TRUNC)
+        length &= ~STRING_TRUNC
+        text = self.data[self.pos:self.pos + length].decode("utf-8", errors="replace")
+        self.pos += (length + 7) & ~7
+        return text + TRUNC_MARKER if truncated else text
+
+
+def to_signed(value, length):
+    bits = 64 if length in ("l", "ll") else 32
+    value &= (1 << bits) - 1
+    return value - (1 << bits) if value >> (bits - 1) else value
+
+
+def to_unsigned(value, length):
+    bits = {"hh": 8, "h": 16, "l": 64, "ll": 64}.get(length, 32)
+    return value & ((1 << bits) - 1)
+
+
+def pad(text, width, flags, allow_zero):
+    if len(text) >= width:
+        return text
+    if "-" in flags:
+        return text.ljust(width)
+    if "0" in flags and allow_zero:
+        sign = text[0] if text[:1] in ("-", "+", " ") else ""
+        prefix = text[len(sign):len(sign) + 2] if text[len(sign):len(sign) + 2] in ("0x", "0X") \
+            else ""
+        body = text[len(sign) + len(prefix):]
+        return sign + prefix + body.rjust(width - len(sign) - len(prefix), "0")
+    return text.rjust(width)
+
+
+def format_record(fmt, reader):
+    """Apply the val_log() conversions to fmt using arguments from reader."""
+    out = []
+    pos = 0
+    for match in CONV_RE.finditer(fmt):
+        out.append(fmt[pos:match.start()])
+        pos = match.end()
+        flags, width, length, conv = match.groups()
+        if width == "*":
+            width = to_signed(reader.u64(), None)
+            if width < 0:
+                flags += "-"
+                width = -width
+        else:
+            width = int(width) if width else 0
+
+        if conv == "%":
+            out.append("%")
+        elif conv == "c":
+            out.append(pad(chr(reader.u64() & 0xFF), width, flags, False))
+        elif conv == "s":
+            out.append(pad(reader.string(), width, flags, False))
+        elif conv in "di":
+            value = to_signed(reader.u64(), length)
+            text = str(value)
+            if value >= 0 and "+" in flags:
+                text = "+" + text
+            elif value >= 0 and " " in flags:
+                text = " " + text
+            out.append(pad(text, width, flags, True))
+        elif conv in "bBoxXu":
+            value = to_unsigned(reader.u64(), length)
+            base = {"b": "b", "B": "b", "o": "o", "x": "x", "X": "X", "u": "d"}[conv]
+            text = format(value, base)
+            if "#" in flags and conv in "xX" and value:
+                text = ("0X" if conv == "X" else "0x") + text
+            out.append(pad(text, width, flags, True))
+        elif conv == "p":
+            out.append(pad("0x" + format(reader.u64(), "x"), 18, "0", True))
+        else:
+            # val_log() stops at an unknown conversion
+            return "".join(out), False
+    out.append(fmt[pos:])
+    return "".join(out), True
+
+
+def decode(rodata, payload):
+    lines = []
+    pos = 0
+    at_line_start = True
+    while pos + 8 <= len(payload):
+        word, size = struct.unpack_from("<II", payload, pos)
+        if (word >> 24) != REC_MAGIC or size < 16 or pos + size > len(payload):
+            print(f"warning: bad record at offset {pos:#x}, stopping", file=sys.stderr)
+            break
+
+        level = (word >> 16) & 0xFF
+        reader = Reader(payload, pos + 8)
+        if word & REC_FMT_INLINE:
+            fmt = reader.string()
+        else:
+            offset = reader.u64()
+            end = rodata.find(b"\0", offset)
+            fmt = rodata[offset:end].decode("utf-8", errors="replace")
+
+        if word & REC_FMT_TRUNC:
+            # Arguments were not recorded; show the format text as captured
+            text = fmt + "\n"
+        else:
+            text, _ = format_record(fmt, reader)
+
+        # Same line assembly as val_printf(): prefix once per logical line
+        stripped = text.lstrip("\n")
+        if len(stripped) != len(text):
+            lines.append("\n" * (len(text) - len(stripped)))
+            at_line_start = True
+        if stripped:
+            if at_line_start:
+                lines.append(LEVEL_PREFIX.get(level, ""))
+            lines.append(stripped)
+            at_line_start = stripped.endswith("\n")
+        pos += size
+    return "".join(lines)
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("elf", help="ELF image the log was produced by")
+    parser.add_argument("log", help="console log containing the ACS-DLOG dump")
+    parser.add_argument("-o", "--output", help="write decoded text here instead of stdout")
+    args = parser.parse_args(argv[1:])
+
+    _, rodata = read_rodata(args.elf)
+    _, _, dropped, payload = read_dump(args.log)
+    text = decode(rodata, payload)
+
+    if dropped:
+        text += f"\n<{dropped} messages dropped: deferred log buffer full>\n"
+
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as out:
+            out.write(text)
+    else:
+        sys.stdout.write(text)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
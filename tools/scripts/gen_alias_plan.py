@@ -0,0 +1,206 @@
+## @file
+ # Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ # SPDX-License-Identifier : Apache-2.0
+ #
+ # Licensed under the Apache License, Version 2.0 (the "License");
+ # you may not use this file except in compliance with the License.
+ # You may obtain a copy of the License at
+ #
+ #  http://www.apache.org/licenses/LICENSE-2.0
+ #
+ # Unless required by applicable law or agreed to in writing, software
+ # distributed under the License is distributed on an "AS IS" BASIS,
+ # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ # See the License for the specific language governing permissions and
+ # limitations under the License.
+ ##
+
+"""Generate val/src/rule_alias_plan.c from the alias tables in rule_metadata.c.
+
+The alias graph (alias_rule_map and the *_rule_list arrays it references) is
+validated here instead of at run time:
+  - every alias entry must reference a defined, RULE_ID_SENTINEL terminated list
+  - an alias rule id must appear only once in alias_rule_map
+  - the graph must be acyclic
+  - the deepest alias chain, plus the base rule at its end, must fit
+    RULE_REFERENCE_PATH_MAX_DEPTH
+
+The generated file provides an O(1) rule id -> alias_rule_map slot table.
+
+Usage:
+  python3 tools/scripts/gen_alias_plan.py                  # regenerate
+  python3 tools/scripts/gen_alias_plan.py --check          # fail if out of date
+  python3 tools/scripts/gen_alias_plan.py --output <file>  # write elsewhere
+"""
+
+import os
+import re
+import sys
+
+ROOT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+METADATA_C = os.path.join(ROOT_DIR, "val", "src", "rule_metadata.c")
+EXEC_H = os.path.join(ROOT_DIR, "val", "include", "rule_based_execution.h")
+OUTPUT_C = os.path.join(ROOT_DIR, "val", "src", "rule_alias_plan.c")
+
+LIST_RE = re.compile(r"const\s+RULE_ID_e\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\}\s*;", re.S)
+MAP_RE = re.compile(r"const\s+alias_rule_map_t\s+alias_rule_map\s*\[\s*\]\s*=\s*\{(.*?)\}\s*;",
+                    re.S)
+ENTRY_RE = re.compile(r"\{\s*(\w+)\s*,\s*(\w+)\s*\}")
+DEPTH_RE = re.compile(r"#define\s+RULE_REFERENCE_PATH_MAX_DEPTH\s+(\d+)")
+
+HEADER = """/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+/*
+ * GENERATED by tools/scripts/gen_alias_plan.py from val/src/rule_metadata.c.
+ * Do not edit; rerun the script after changing alias_rule_map or any alias
+ * child list. The script rejects alias cycles and chains that would not fit
+ * the rule reference path, so a build from a current plan cannot hit either
+ * at run time.
+ */
+
+#include "rule_based_execution.h"
+"""
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def parse_metadata(path):
+    with open(path, "r", encoding="utf-8") as src:
+        text = strip_comments(src.read())
+
+    lists = {}
+    for name, body in LIST_RE.findall(text):
+        items = [tok.strip() for tok in body.split(",") if tok.strip()]
+        if not items or items[-1] != "RULE_ID_SENTINEL":
+            raise SystemExit(f"error: {name} is not RULE_ID_SENTINEL terminated")
+        lists[name] = items[:-1]
+
+    match = MAP_RE.search(text)
+    if match is None:
+        raise SystemExit("error: alias_rule_map not found in rule_metadata.c")
+
+    alias_map = []
+    for alias, list_name in ENTRY_RE.findall(match.group(1)):
+        if list_name not in lists:
+            raise SystemExit(f"error: alias {alias} references unknown list {list_name}")
+        if any(alias == entry[0] for entry in alias_map):
+            raise SystemExit(f"error: alias {alias} listed more than once in alias_rule_map")
+        alias_map.append((alias, list_name))
+
+    return lists, alias_map
+
+
+def max_path_depth(path):
+    with open(path, "r", encoding="utf-8") as src:
+        match = DEPTH_RE.search(src.read())
+    if match is None:
+        raise SystemExit("error: RULE_REFERENCE_PATH_MAX_DEPTH not found")
+    return int(match.group(1))
+
+
+def check_alias_graph(lists, alias_map, depth_limit):
+    """Reject alias cycles and chains that overflow the rule reference path.
+
+    The orchestrator pushes every alias of a chain and then the base rule it
+    ends in, so a chain of N aliases needs N + 1 reference path entries.
+    """
+    children = {alias: lists[list_name] for alias, list_name in alias_map}
+    depth = {}
+    state = {}
+
+    def visit(alias, path):
+        if state.get(alias) == "done":
+            return depth[alias]
+        if state.get(alias) == "active":
+            cycle = " -> ".join(path[path.index(alias):] + [alias])
+            raise SystemExit(f"error: alias cycle detected: {cycle}")
+
+        state[alias] = "active"
+        child_depth = 0
+        for child in children[alias]:
+            if child in children:
+                child_depth = max(child_depth, visit(child, path + [alias]))
+        state[alias] = "done"
+        depth[alias] = child_depth + 1
+        return depth[alias]
+
+    deepest = 0
+    for alias, _ in alias_map:
+        deepest = max(deepest, visit(alias, []))
+
+    # One reference path entry is left for the base rule the chain ends in
+    if deepest > depth_limit - 1:
+        raise SystemExit(f"error: alias chain depth {deepest} plus its base rule exceeds "
+                         f"RULE_REFERENCE_PATH_MAX_DEPTH ({depth_limit})")
+
+    return deepest
+
+
+def render(alias_map):
+    width = max(len(alias) for alias, _ in alias_map) + 2
+    out = [HEADER]
+    out.append("/* Number of alias_rule_map entries this plan was generated for */")
+    out.append(f"const uint32_t alias_rule_plan_count = {len(alias_map)};\n")
+    out.append("/* alias_rule_map index + 1 for each alias rule id; 0 for base rules */")
+    out.append("const uint8_t alias_rule_map_slot[RULE_ID_SENTINEL] = {")
+    for index, (alias, _) in enumerate(alias_map):
+        out.append(f"    {('[' + alias + ']').ljust(width)} = {index + 1},")
+    out.append("};")
+    return "\n".join(out) + "\n"
+
+
+def main(argv):
+    args = argv[1:]
+    check = "--check" in args
+    output = OUTPUT_C
+    if "--output" in args:
+        index = args.index("--output")
+        if index + 1 >= len(args):
+            raise SystemExit("error: --output needs a file name")
+        output = os.path.abspath(args[index + 1])
+
+    lists, alias_map = parse_metadata(METADATA_C)
+    if len(alias_map) > 255:
+        raise SystemExit("error: alias_rule_map_slot is uint8_t; widen it for >255 aliases")
+
+    check_alias_graph(lists, alias_map, max_path_depth(EXEC_H))
+    generated = render(alias_map)
+
+    current = None
+    if os.path.exists(output):
+        with open(output, "r", encoding="utf-8") as dst:
+            current = dst.read()
+
+    if check:
+        if current != generated:
+            print(f"{os.path.relpath(output, ROOT_DIR)} is out of date; "
+                  "run tools/scripts/gen_alias_plan.py")
+            return 1
+        return 0
+
+    if current != generated:
+        with open(output, "w", encoding="utf-8") as dst:
+            dst.write(generated)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -24,6 +24,17 @@ extern GIC_ITS_INFO    *g_gic_its_info;
 static uint32_t        *g_cwriter_ptr;
 static uint32_t        g_its_setup_done;
 
+/* ITT owned by a DeviceID from its first MAPD until it is unmapped */
+typedef struct {
+  uint64_t    itt_base;
+  uint32_t    its_index;
+  uint32_t    device_id;
+  uint32_t    event_bits;
+  uint32_t    in_use;
+} its_device_itt_t;
+
+static its_device_itt_t g_its_device_itt[ITS_MAX_MAPPED_DEVICES];
+
 uint32_t GET_NUM_BITS(uint64_t value)
 {
   uint64_t bit_pos = 0;
@@ -280,18 +291,7 @@ static uint32_t ArmGicSetItsTables(uint32_t its_index)
 
   }
 
-  /* Allocate Memory for Interrupt Translation Table */
-  Address = (uint64_t)val_aligned_alloc(SIZE_64KB, (NUM_PAGES_8 * SIZE_4KB));
-
-  if (!Address) {
-    val_print(ERROR,  "ITS : Could Not Allocate Memory For ITT. Test may not pass.\n");
-    return 1;
-  }
-
-  val_memory_set((void *)Address, (NUM_PAGES_8*SIZE_4KB), 0);
-
-  g_gic_its_info->GicIts[its_index].ITTBase = Address;
-
+  /* Interrupt Translation Tables are allocated per DeviceID at MAPD time */
   return 0;
 }
 
@@ -305,6 +305,12 @@ static void EnableITS(uint64_t GicItsBase)
   val_mmio_write(GicItsBase + ARM_GITS_CTLR, (value | ARM_GITS_CTLR_ENABLE));
 }
 
+static void ItsCmdQAdvance(uint32_t its_index)
+{
+  /* The queue is circular; CWRITER wraps back to the start of CBASER */
+  g_cwriter_ptr[its_index] = (g_cwriter_ptr[its_index] + ITS_NEXT_CMD_PTR) % ITS_CMDQ_NUM_DW;
+}
+
 static void
 WriteCmdQMAPD(
    uint32_t     its_index,
@@ -321,7 +327,7 @@ WriteCmdQMAPD(
     val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 2),
                      (uint64_t)((Valid << ITS_CMD_SHIFT_VALID) | (ITT_BASE & ITT_PAR_MASK)));
     val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 3), (uint64_t)(0x0));
-    g_cwriter_ptr[its_index] = g_cwriter_ptr[its_index] + ITS_NEXT_CMD_PTR;
+    ItsCmdQAdvance(its_index);
 }
 
 static void
@@ -339,7 +345,7 @@ WriteCmdQMAPC(
     val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 2),
                      (uint64_t)((Valid << ITS_CMD_SHIFT_VALID) | RDBase | Clctn_ID));
     val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 3), (uint64_t)(0x0));
-    g_cwriter_ptr[its_index] = g_cwriter_ptr[its_index] + ITS_NEXT_CMD_PTR;
+    ItsCmdQAdvance(its_index);
 }
 
 static void
@@ -357,7 +363,7 @@ WriteCmdQMAPTI(
                      ((uint64_t)(int_id-ARM_LPI_MINID) | ((uint64_t)int_id << 32)));
     val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 2), (uint64_t)(Clctn_ID));
     val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 3), (uint64_t)(0));
-    g_cwriter_ptr[its_index] = g_cwriter_ptr[its_index] + ITS_NEXT_CMD_PTR;
+    ItsCmdQAdvance(its_index);
 }
 
 static void
@@ -374,7 +380,7 @@ WriteCmdQINV(
                      (uint64_t)(int_id-ARM_LPI_MINID));
     val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 2), (uint64_t)(0x0));
     val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 3), (uint64_t)(0x0));
-    g_cwriter_ptr[its_index] = g_cwriter_ptr[its_index] + ITS_NEXT_CMD_PTR;
+    ItsCmdQAdvance(its_index);
 }
 
 static void
@@ -391,7 +397,7 @@ WriteCmdQDISCARD(
                      (uint64_t)(int_id-ARM_LPI_MINID));
     val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 2), (uint64_t)(0x0));
     val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 3), (uint64_t)(0x0));
-    g_cwriter_ptr[its_index] = g_cwriter_ptr[its_index] + ITS_NEXT_CMD_PTR;
+    ItsCmdQAdvance(its_index);
 }
 
 
@@ -407,7 +413,7 @@ WriteCmdQSYNC(
     val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 1), (uint64_t)(0x0));
     val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 2), (uint64_t)(RDBase));
     val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 3), (uint64_t)(0x0));
-    g_cwriter_ptr[its_index] = g_cwriter_ptr[its_index] + ITS_NEXT_CMD_PTR;
+    ItsCmdQAdvance(its_index);
 }
 
 static void PollTillCommandQueueDone(uint32_t its_index)
@@ -471,61 +477,286 @@ static uint64_t GetRDBaseFormat(uint32_t its_index)
 }
 
 
-void val_its_clear_lpi_map(uint32_t its_index, uint32_t device_id, uint32_t int_id)
+static void ItsCmdQFlush(uint32_t its_index)
 {
   uint64_t    value;
-  uint64_t    RDBase;
   uint64_t    ItsBase;
+
+  ItsBase = g_gic_its_info->GicIts[its_index].Base;
+
+  dsbsy();
+  /* Update the CWRITER Register so that all the commands from Command queue gets executed.*/
+  value = ((g_cwriter_ptr[its_index] * NUM_BYTES_IN_DW));
+  val_mmio_write64((ItsBase + ARM_GITS_CWRITER), value);
+
+  /* Check CREADR value which ensures Command Queue is processed */
+  PollTillCommandQueueDone(its_index);
+  dsbsy();
+}
+
+static uint32_t ItsCmdQFreeCmds(uint32_t its_index)
+{
+  uint64_t    creadr_dw;
+  uint32_t    used_dw;
+  uint64_t    ItsBase;
+
+  ItsBase = g_gic_its_info->GicIts[its_index].Base;
+  creadr_dw = (val_mmio_read64(ItsBase + ARM_GITS_CREADR) & ARM_GITS_CREADR_OFFSET_MASK)
+              / NUM_BYTES_IN_DW;
+  used_dw = (uint32_t)((g_cwriter_ptr[its_index] + ITS_CMDQ_NUM_DW - creadr_dw) % ITS_CMDQ_NUM_DW);
+
+  /* One slot always stays empty so that a full queue is not mistaken for an empty one */
+  return ((ITS_CMDQ_NUM_DW - used_dw) / ITS_NEXT_CMD_PTR) - 1;
+}
+
+/* Claim num_cmds queue slots, keeping one spare for the closing SYNC. When the
+   queue cannot take them, close what is queued with a SYNC in the spare slot,
+   publish it and wait for the ITS. cmdq_mark holds the write pointer last
+   published to CWRITER; if the queue is still full the unpublished commands
+   are dropped by winding the write pointer back to it. */
+static uint32_t ItsCmdQReserve(uint32_t its_index, uint64_t ItsCommandBase, uint64_t RDBase,
+                               uint32_t *cmdq_mark, uint32_t *free_cmds, uint32_t num_cmds)
+{
+  if (*free_cmds < num_cmds + 1) {
+    if (g_cwriter_ptr[its_index] != *cmdq_mark) {
+      WriteCmdQSYNC(its_index, (uint64_t *)(ItsCommandBase), RDBase);
+      ItsCmdQFlush(its_index);
+      *cmdq_mark = g_cwriter_ptr[its_index];
+    } else {
+      PollTillCommandQueueDone(its_index);
+    }
+
+    *free_cmds = ItsCmdQFreeCmds(its_index);
+    if (*free_cmds < num_cmds + 1) {
+      val_print(ERROR, "\n       ITS : Command Queue full, Test may not pass");
+      g_cwriter_ptr[its_index] = *cmdq_mark;
+      return 1;
+    }
+  }
+
+  *free_cmds -= num_cmds;
+  return 0;
+}
+
+/* Return 1 if map[index] is the first entry in the batch for its DeviceID */
+static uint32_t ItsFirstDeviceEntry(const its_lpi_map_t *map, uint32_t index)
+{
+  uint32_t    i;
+
+  for (i = 0; i < index; i++) {
+    if (map[i].device_id == map[index].device_id)
+      return 0;
+  }
+
+  return 1;
+}
+
+static its_device_itt_t *ItsDeviceIttFind(uint32_t its_index, uint32_t device_id)
+{
+  uint32_t    i;
+
+  for (i = 0; i < ITS_MAX_MAPPED_DEVICES; i++) {
+    if (g_its_device_itt[i].in_use && (g_its_device_itt[i].its_index == its_index) &&
+        (g_its_device_itt[i].device_id == device_id))
+      return &g_its_device_itt[i];
+  }
+
+  return NULL;
+}
+
+/* EventID bits needed for every LPI of map[index]'s DeviceID in the list */
+static uint32_t ItsDeviceEventBits(const its_lpi_map_t *map, uint32_t count, uint32_t index)
+{
+  uint32_t    i;
+  uint32_t    event_id;
+  uint32_t    max_event_id = 0;
+  uint32_t    event_bits = ITS_ITT_MIN_EVENT_BITS;
+
+  for (i = index; i < count; i++) {
+    if (map[i].device_id != map[index].device_id)
+      continue;
+    event_id = map[i].int_id - ARM_LPI_MINID;
+    if (event_id > max_event_id)
+      max_event_id = event_id;
+  }
+
+  while ((event_bits < 32) && (max_event_id >> event_bits))
+    event_bits++;
+
+  return event_bits;
+}
+
+/* Find the ITT of a DeviceID, or allocate one sized for event_bits. An ITT
+   in use cannot be resized, so a mapped device that needs more EventID bits
+   than its ITT covers is an error. */
+static its_device_itt_t *ItsDeviceIttGet(uint32_t its_index, uint32_t device_id,
+                                         uint32_t event_bits)
+{
+  its_device_itt_t *itt;
+  uint64_t    ItsBase;
+  uint32_t    itt_size;
+  uint32_t    i;
+
+  if (event_bits > g_gic_its_info->GicIts[its_index].IDBits + 1) {
+    val_print(ERROR, "\n       ITS : EventID exceeds GITS_TYPER.ID_bits for device 0x%x",
+              device_id);
+    return NULL;
+  }
+
+  itt = ItsDeviceIttFind(its_index, device_id);
+  if (itt != NULL) {
+    if (itt->event_bits < event_bits) {
+      val_print(ERROR, "\n       ITS : ITT of mapped device 0x%x is too small", device_id);
+      return NULL;
+    }
+    return itt;
+  }
+
+  for (i = 0; i < ITS_MAX_MAPPED_DEVICES; i++) {
+    if (!g_its_device_itt[i].in_use)
+      break;
+  }
+
+  if (i == ITS_MAX_MAPPED_DEVICES) {
+    val_print(ERROR, "\n       ITS : Too many mapped devices, Test may not pass");
+    return NULL;
+  }
+
+  ItsBase = g_gic_its_info->GicIts[its_index].Base;
+  itt_size = (1u << event_bits) *
+             ARM_GITS_TYPER_ITTEntrySize(val_mmio_read64(ItsBase + ARM_GITS_TYPER));
+
+  itt = &g_its_device_itt[i];
+  itt->itt_base = (uint64_t)val_aligned_alloc(SIZE_4KB, itt_size);
+  if (!itt->itt_base) {
+    val_print(ERROR, "\n       ITS : Could Not Allocate Memory For ITT. Test may not pass");
+    return NULL;
+  }
+
+  val_memory_set((void *)itt->itt_base, itt_size, 0);
+
+  itt->its_index  = its_index;
+  itt->device_id  = device_id;
+  itt->event_bits = event_bits;
+  itt->in_use     = 1;
+
+  return itt;
+}
+
+static void ItsDeviceIttRelease(its_device_itt_t *itt)
+{
+  val_memory_free_aligned((void *)itt->itt_base);
+  itt->in_use = 0;
+}
+
+/**
+  @brief   Remove the ITS mappings for a list of (DeviceID, LPI) pairs. All
+           DISCARD and MAPD commands are queued, followed by one SYNC, and
+           the command queue is drained once for the whole list. The ITTs of
+           the unmapped devices are freed afterwards.
+  @param   its_index  Index of the ITS in the ITS info table
+  @param   map        List of (DeviceID, LPI) pairs to unmap
+  @param   count      Number of entries in map
+  @return  None
+**/
+void val_its_clear_lpi_map_bulk(uint32_t its_index, const its_lpi_map_t *map, uint32_t count)
+{
+  its_device_itt_t *itt;
+  uint32_t    index;
+  uint32_t    free_cmds;
+  uint32_t    cmdq_mark;
+  uint64_t    RDBase;
   uint64_t    ItsCommandBase;
 
-  if (!g_its_setup_done)
+  if (!g_its_setup_done || (map == NULL) || (count == 0))
     return;
 
-  ItsBase        = g_gic_its_info->GicIts[its_index].Base;
   ItsCommandBase = g_gic_its_info->GicIts[its_index].CommandQBase;
 
-  /* Clear Config table for LPI=int_id */
-  ClearConfigTable(int_id);
+  /* Clear Config table for each LPI */
+  for (index = 0; index < count; index++)
+    ClearConfigTable(map[index].int_id);
 
   /* Get RDBase Depending on GITS_TYPER.PTA */
   RDBase = GetRDBaseFormat(its_index);
 
-  /* Discard Mappings */
-  WriteCmdQDISCARD(its_index, (uint64_t *)(ItsCommandBase), device_id, int_id);
-  /* Un Map Device using MAPD */
-  WriteCmdQMAPD(its_index, (uint64_t *)(ItsCommandBase), device_id,
-                g_gic_its_info->GicIts[its_index].ITTBase,
-                0, 0 /*InValid*/);
+  cmdq_mark = g_cwriter_ptr[its_index];
+  free_cmds = ItsCmdQFreeCmds(its_index);
+
+  /* Discard Mappings, before any device in the list is unmapped */
+  for (index = 0; index < count; index++) {
+    if (ItsCmdQReserve(its_index, ItsCommandBase, RDBase, &cmdq_mark, &free_cmds, 1))
+      return;
+    WriteCmdQDISCARD(its_index, (uint64_t *)(ItsCommandBase),
+                     map[index].device_id, map[index].int_id);
+  }
+
+  /* Un Map each Device once using MAPD */
+  for (index = 0; index < count; index++) {
+    if (!ItsFirstDeviceEntry(map, index))
+      continue;
+    if (ItsCmdQReserve(its_index, ItsCommandBase, RDBase, &cmdq_mark, &free_cmds, 1))
+      return;
+    WriteCmdQMAPD(its_index, (uint64_t *)(ItsCommandBase), map[index].device_id,
+                  0, 0, 0 /*InValid*/);
+  }
+
   /* ITS SYNC Command */
   WriteCmdQSYNC(its_index, (uint64_t *)(ItsCommandBase), RDBase);
 
-  dsbsy();
-  /* Update the CWRITER Register so that all the commands from Command queue gets executed.*/
-  value = ((g_cwriter_ptr[its_index] * NUM_BYTES_IN_DW));
-  val_mmio_write64((ItsBase + ARM_GITS_CWRITER), value);
-
-  /* Check CREADR value which ensures Command Queue is processed */
-  PollTillCommandQueueDone(its_index);
-  dsbsy();
+  ItsCmdQFlush(its_index);
 
+  /* The ITS no longer references the ITTs of the unmapped devices */
+  for (index = 0; index < count; index++) {
+    if (!ItsFirstDeviceEntry(map, index))
+      continue;
+    itt = ItsDeviceIttFind(its_index, map[index].device_id);
+    if (itt != NULL)
+      ItsDeviceIttRelease(itt);
+  }
 }
 
-void val_its_create_lpi_map(uint32_t its_index, uint32_t device_id,
-                            uint32_t int_id, uint32_t Priority)
+/**
+  @brief   Map a list of (DeviceID, LPI) pairs through the ITS. Each device is
+           mapped once with MAPD to an ITT of its own, the collection once with
+           MAPC, and each LPI with MAPTI + INV, followed by one SYNC. The command queue is drained
+           once for the whole list, or earlier only if the list does not fit.
+  @param   its_index  Index of the ITS in the ITS info table
+  @param   map        List of (DeviceID, LPI) pairs to map
+  @param   count      Number of entries in map
+  @param   Priority   Priority programmed for every LPI in the list
+  @return  None
+**/
+void val_its_create_lpi_map_bulk(uint32_t its_index, const its_lpi_map_t *map,
+                                 uint32_t count, uint32_t Priority)
 {
-  uint64_t    value;
+  its_device_itt_t *itt;
+  uint32_t    index;
+  uint32_t    new_device;
+  uint32_t    free_cmds;
+  uint32_t    cmdq_mark;
   uint64_t    RDBase;
   uint64_t    ItsBase;
   uint64_t    ItsCommandBase;
 
-  if (!g_its_setup_done)
+  if (!g_its_setup_done || (map == NULL) || (count == 0))
     return;
 
   ItsBase        = g_gic_its_info->GicIts[its_index].Base;
   ItsCommandBase = g_gic_its_info->GicIts[its_index].CommandQBase;
 
+  /* Give every DeviceID its own ITT before any command is queued */
+  for (index = 0; index < count; index++) {
+    if (!ItsFirstDeviceEntry(map, index))
+      continue;
+    if (ItsDeviceIttGet(its_index, map[index].device_id,
+                        ItsDeviceEventBits(map, count, index)) == NULL)
+      return;
+  }
+
   /* Set Config table with enable the LPI = int_id, Priority. */
-  SetConfigTable(int_id, Priority);
+  for (index = 0; index < count; index++)
+    SetConfigTable(map[index].int_id, Priority);
 
   /* Enable Redistributor */
   EnableLPIsRD(g_gic_its_info->GicRdBase);
@@ -536,30 +767,58 @@ void val_its_create_lpi_map(uint32_t its_index, uint32_t device_id,
   /* Get RDBase Depending on GITS_TYPER.PTA */
   RDBase = GetRDBaseFormat(its_index);
 
-  /* Map Device using MAPD */
-  WriteCmdQMAPD(its_index, (uint64_t *)(ItsCommandBase), device_id,
-                g_gic_its_info->GicIts[its_index].ITTBase,
-                g_gic_its_info->GicIts[its_index].IDBits, 0x1 /*Valid*/);
+  cmdq_mark = g_cwriter_ptr[its_index];
+  free_cmds = ItsCmdQFreeCmds(its_index);
+
   /* Map Collection using MAPC */
+  if (ItsCmdQReserve(its_index, ItsCommandBase, RDBase, &cmdq_mark, &free_cmds, 1))
+    return;
   WriteCmdQMAPC(its_index, (uint64_t *)(ItsCommandBase),
                 0x1 /*Clctn_ID*/, RDBase, 0x1 /*Valid*/);
-  /* Map Interrupt using MAPI */
-  WriteCmdQMAPTI(its_index, (uint64_t *)(ItsCommandBase), device_id, int_id, 0x1 /*Clctn_ID*/);
-  /* Invalid Entry */
-  WriteCmdQINV(its_index, (uint64_t *)(ItsCommandBase), device_id, int_id);
+
+  for (index = 0; index < count; index++) {
+    new_device = ItsFirstDeviceEntry(map, index);
+    if (ItsCmdQReserve(its_index, ItsCommandBase, RDBase, &cmdq_mark,
+                       &free_cmds, 2 + new_device))
+      return;
+
+    /* Map Device using MAPD, Size is the number of EventID bits minus one */
+    if (new_device) {
+      itt = ItsDeviceIttFind(its_index, map[index].device_id);
+      WriteCmdQMAPD(its_index, (uint64_t *)(ItsCommandBase), map[index].device_id,
+                    itt->itt_base, itt->event_bits - 1, 0x1 /*Valid*/);
+    }
+    /* Map Interrupt using MAPI */
+    WriteCmdQMAPTI(its_index, (uint64_t *)(ItsCommandBase), map[index].device_id,
+                   map[index].int_id, 0x1 /*Clctn_ID*/);
+    /* Invalid Entry */
+    WriteCmdQINV(its_index, (uint64_t *)(ItsCommandBase), map[index].device_id,
+                 map[index].int_id);
+  }
+
   /* ITS SYNC Command */
   WriteCmdQSYNC(its_index, (uint64_t *)(ItsCommandBase), RDBase);
 
-  dsbsy();
+  ItsCmdQFlush(its_index);
+}
 
-  /* Update the CWRITER Register so that all the commands from Command queue gets executed.*/
-  value = ((g_cwriter_ptr[its_index] * NUM_BYTES_IN_DW));
-  val_mmio_write64((ItsBase + ARM_GITS_CWRITER), value);
+void val_its_clear_lpi_map(uint32_t its_index, uint32_t device_id, uint32_t int_id)
+{
+  its_lpi_map_t map;
 
-  /* Check CREADR value which ensures Command Queue is processed */
-  PollTillCommandQueueDone(its_index);
-  dsbsy();
+  map.device_id = device_id;
+  map.int_id    = int_id;
+  val_its_clear_lpi_map_bulk(its_index, &map, 1);
+}
+
+void val_its_create_lpi_map(uint32_t its_index, uint32_t device_id,
+                            uint32_t int_id, uint32_t Priority)
+{
+  its_lpi_map_t map;
 
+  map.device_id = device_id;
+  map.int_id    = int_id;
+  val_its_create_lpi_map_bulk(its_index, &map, 1, Priority);
 }
 
 
@@ -126,10 +126,12 @@
 #define ARM_GITS_TYPER_DevBits(its_typer)           ((its_typer >> 13) & 0x1F)
 #define ARM_GITS_TYPER_CIDBits(its_typer)           ((its_typer >> 32) & 0xF)
 #define ARM_GITS_TYPER_IDbits(its_typer)            ((its_typer >> 8) & 0x1F)
+#define ARM_GITS_TYPER_ITTEntrySize(its_typer)      (((its_typer >> 4) & 0xF) + 1)
 #define ARM_GITS_TYPER_PTA                          (1 << 19)
 
 /* GITS_CREADR Bits */
 #define ARM_GITS_CREADR_STALL       (1 << 0)
+#define ARM_GITS_CREADR_OFFSET_MASK (0xFFFE0ULL)
 
 /* GITS_CWRITER Bits */
 #define ARM_GITS_CWRITER_RETRY      (1 << 0)
@@ -184,6 +186,21 @@
 #define ITS_NEXT_CMD_PTR    4
 #define NUM_BYTES_IN_DW     8
 
+/* Command queue is NUM_PAGES_8 x 4KB, indexed in doublewords by g_cwriter_ptr */
+#define ITS_CMDQ_SIZE       (NUM_PAGES_8 * SIZE_4KB)
+#define ITS_CMDQ_NUM_DW     (ITS_CMDQ_SIZE / NUM_BYTES_IN_DW)
+#define ITS_CMDQ_NUM_CMDS   (ITS_CMDQ_NUM_DW / ITS_NEXT_CMD_PTR)
+
+/* Every mapped DeviceID owns an ITT covering at least ITS_ITT_MIN_EVENT_BITS */
+#define ITS_ITT_MIN_EVENT_BITS  8
+#define ITS_MAX_MAPPED_DEVICES  64
+
+/* One (DeviceID, LPI) pair for the bulk ITS mapping interfaces */
+typedef struct {
+  uint32_t device_id;
+  uint32_t int_id;
+} its_lpi_map_t;
+
 uint32_t ArmGicRedistributorConfigurationForLPI(uint64_t rd_base);
 
 void ClearConfigTable(uint32_t int_id);
@@ -197,6 +214,9 @@ void EnableLPIsRD(uint64_t rd_base);
 void val_its_create_lpi_map(uint32_t its_index, uint32_t device_id,
                             uint32_t int_id, uint32_t Priority);
 void val_its_clear_lpi_map(uint32_t its_index, uint32_t device_id, uint32_t int_id);
+void val_its_create_lpi_map_bulk(uint32_t its_index, const its_lpi_map_t *map,
+                                 uint32_t count, uint32_t Priority);
+void val_its_clear_lpi_map_bulk(uint32_t its_index, const its_lpi_map_t *map, uint32_t count);
 
 uint64_t val_its_get_translater_addr(uint32_t its_index);
 uint32_t val_its_get_max_lpi(void);
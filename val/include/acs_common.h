@@ -160,6 +160,9 @@ val_run_test_payload(uint32_t test_num, uint32_t num_pe, void (*payload)(void),
 void
 val_run_test_configurable_payload(void *arg, void (*payload)(void *));
 
+uint64_t
+val_get_test_payload_ticks(void);
+
 void
 val_data_cache_ops_by_va(addr_t addr, uint32_t type);
 
@@ -39,6 +39,7 @@
 #define CXL_DVSEC_ID_GPF_DEVICE           0x0005
 #define CXL_DVSEC_ID_PCIE_FLEXBUS_PORT    0x0007
 #define CXL_DVSEC_ID_REGISTER_LOCATOR     0x0008
+#define CXL_DVSEC_ID_INDEX_MAX            (CXL_DVSEC_ID_REGISTER_LOCATOR + 1)
 
 /* ---- Register Locator entry decode ---- */
 /* ----   DVSEC len = 0x0C + n*8   ------- */
@@ -99,6 +100,9 @@
 #define CXL_CAPID_BI_DECODER            0x000C
 #define CXL_CAPID_CACHE_ID_DECODER      0x000E
 
+/* Capability IDs below this limit are cached as a per host bridge bitmask */
+#define CXL_CAP_MASK_ID_LIMIT           32
+
 /* CXL Device Register Cap IDs */
 #define CXL_DEVCAPID_DEVICE_STATUS      0x0001
 #define CXL_DEVCAPID_PRI_MAILBOX        0x0002
@@ -237,6 +241,9 @@ typedef struct {
   uint64_t device_reg_base;
   uint32_t device_reg_length;
   uint32_t hdm_decoder_count;
+  uint16_t dvsec_offset[CXL_DVSEC_ID_INDEX_MAX]; /* Config offset per DVSEC ID, 0 if absent */
+  uint16_t cxl_capability;                        /* CXL Capability field of the device DVSEC */
+  uint32_t dvsec_indexed;                         /* 1 once the DVSEC walk has completed */
 } CXL_COMPONENT_ENTRY;
 
 typedef struct {
@@ -157,9 +157,66 @@
 /* Timestamp Invalid */
 #define TRACE_PKT_INVALID 0xFFFF
 
+/* Per-PE trace buffer window used by val_ete_generate_trace */
+#define ETE_PE_TRACE_BUF_SIZE   0x1000
+
+/* Timestamp packet layout */
+#define TS_FIELD_LAYOUT_LEN     0x09
+#define TS_CC_LAYOUT_LEN        0x03
+
+/* Decoded packet classes reported by val_ete_decode_next */
+typedef enum {
+  ETE_PKT_ALIGN_SYNC = 0,
+  ETE_PKT_DISCARD_OVERFLOW,
+  ETE_PKT_TRACE_INFO,
+  ETE_PKT_TIMESTAMP,
+  ETE_PKT_TIMESTAMP_MARKER,
+  ETE_PKT_TRACE_ON,
+  ETE_PKT_EXCEPTION,
+  ETE_PKT_INSTRUMENT,
+  ETE_PKT_TRANSACTION,
+  ETE_PKT_CYCLE_COUNT,
+  ETE_PKT_COMMIT,
+  ETE_PKT_IGNORE,
+  ETE_PKT_CONTEXT,
+  ETE_PKT_TARGET_ADDR,
+  ETE_PKT_SOURCE_ADDR,
+  ETE_PKT_Q,
+  ETE_PKT_ATOM,
+  ETE_PKT_EVENT,
+  ETE_PKT_MISPREDICT,
+  ETE_PKT_CANCEL,
+  ETE_PKT_TYPE_MAX
+} ETE_PKT_TYPE_e;
+
+/* Return codes of val_ete_decode_next */
+#define ETE_DECODE_OK           0x0
+#define ETE_DECODE_END          0x1  /* No bytes left in the stream             */
+#define ETE_DECODE_TRUNCATED    0x2  /* Packet runs past the end of the stream  */
+#define ETE_DECODE_INVALID      0x3  /* Reserved or unknown header byte         */
+
+typedef struct {
+  uint32_t type;      /* One of ETE_PKT_TYPE_e                  */
+  uint32_t header;    /* Header byte of the packet              */
+  uint64_t offset;    /* Offset of the header within the stream */
+  uint64_t length;    /* Total packet length in bytes           */
+} ETE_PACKET;
+
+typedef struct {
+  const uint8_t *stream;
+  uint64_t size;
+  uint64_t offset;
+  uint32_t commopt;   /* TRCIDR0.COMMOPT, selects Cycle Count Format 1 layout */
+} ETE_DECODER;
+
+/* Trace Decoder Calls - no VAL/PAL dependencies, builds on a Linux host */
+void     val_ete_decoder_init(ETE_DECODER *dec, const uint8_t *stream, uint64_t size,
+                              uint32_t commopt);
+uint32_t val_ete_decode_next(ETE_DECODER *dec, ETE_PACKET *pkt);
+uint64_t val_ete_decode_timestamp(const uint8_t *stream, const ETE_PACKET *pkt);
+
 /* Trace Related Calls */
-uint64_t trace_cbit_len(uint8_t *trace_stream, uint64_t index, uint64_t position,
-                                     uint64_t layout_len);
+uint64_t parse_tracestream(uint8_t *trace_bytes, uint64_t trace_size);
 uint64_t val_ete_get_trace_timestamp(uint64_t buffer_address);
 uint64_t val_ete_generate_trace(uint64_t buffer_address, uint32_t self_hosted_trace_enabled);
 
@@ -30,7 +30,18 @@
  * - wakeup/watchdog/timer timeout controls
  * - crypto-extension and EL1 trap workarounds
  * - system last-level cache hinting
+ * - rule timing profile report format
+ * - deferred (binary) capture of every log message
  */
+
+/* Rule timing profile report formats (-profile) */
+typedef enum {
+    PROFILE_FORMAT_NONE = 0,
+    PROFILE_FORMAT_SUMMARY,
+    PROFILE_FORMAT_JSON,
+    PROFILE_FORMAT_CSV
+} PROFILE_FORMAT_e;
+
 typedef struct acs_execution_policy {
     uint32_t pcie_p2p;
     uint32_t pcie_cache_present;
@@ -53,6 +64,11 @@ typedef struct acs_execution_policy {
      * not safely expose them. Compose with EL1SKIPTRAP_* flags.
      */
     uint32_t el1skiptrap_mask;
+    /* Rule timing report printed after run_tests(), see PROFILE_FORMAT_e */
+    uint32_t profile_format;
+    /* Capture every val_print message, whatever its level, in a binary
+       buffer decoded on the host afterwards (baremetal only) */
+    uint32_t deferred_log;
 } acs_execution_policy_t;
 
 void acs_reset_execution_policy(void);
@@ -69,5 +85,7 @@ uint32_t acs_policy_get_timer_timeout_us(void);
 uint32_t acs_policy_get_crypto_support(void);
 uint32_t acs_policy_get_sys_last_lvl_cache(void);
 uint32_t acs_policy_get_el1skiptrap_mask(void);
+uint32_t acs_policy_get_profile_format(void);
+uint32_t acs_policy_get_deferred_log(void);
 
 #endif /* __ACS_EXECUTION_POLICY_H__ */
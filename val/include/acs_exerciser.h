@@ -117,6 +117,7 @@ uint32_t val_exerciser_set_param(EXERCISER_PARAM_TYPE type, uint64_t value1, uin
 uint32_t val_exerciser_get_param(EXERCISER_PARAM_TYPE type, uint64_t *value1, uint64_t *value2, uint32_t instance);
 uint32_t val_exerciser_get_state(EXERCISER_STATE *state, uint32_t instance);
 uint32_t val_exerciser_ops(EXERCISER_OPS ops, uint64_t param, uint32_t instance);
+uint32_t val_exerciser_dma_batch(exerciser_dma_xfer_t *xfer, uint32_t count, uint32_t instance);
 uint32_t val_exerciser_get_data(EXERCISER_DATA_TYPE type, exerciser_data_t *data, uint32_t instance);
 uint32_t val_exerciser_get_bdf(uint32_t instance);
 uint32_t val_exerciser_get_exerciser_instance(uint32_t rc_index);
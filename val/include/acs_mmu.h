@@ -51,6 +51,8 @@ extern uint64_t tt_l0_base[];
 #define ATTR_DEVICE_nGnRnE (0x0ULL << MEM_ATTR_INDX_SHIFT)
 
 uint32_t val_mmu_check_for_entry(uint64_t base_addr);
+uint32_t val_mmu_check_for_range(uint64_t base_addr, uint64_t size);
+void     val_mmu_walk_cache_invalidate(void);
 uint32_t val_mmu_add_entry(uint64_t base_addr, uint64_t size, uint64_t attr);
 uint32_t val_mmu_update_entry(uint64_t address, uint32_t size, uint64_t attr);
 #endif
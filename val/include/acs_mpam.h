@@ -71,6 +71,11 @@ typedef enum {
 #define DEFAULT_PMG_MAX 255 //(2^8 - 1)
 #define MPAM_MON_NOT_READY -1
 
+/* A monitor value is taken as settled once the MSC NRDY window has passed
+   and this many consecutive polls, spanning at least two timer event
+   stream periods, read the same value */
+#define MPAM_MON_SETTLE_READS 4
+
 #define MBWU_PREFILL_DELTA  0x1000
 #define MBWU_LONG_CHECK     1U
 #define MBWU_SHORT_CHECK    0U
@@ -100,6 +105,7 @@ uint32_t val_mpam_msc_supports_extd_esr(uint32_t msc_index);
 uint32_t val_mpam_msc_supports_esr(uint32_t msc_index);
 uint32_t val_mpam_msc_supports_partid_endis(uint32_t msc_index);
 uint64_t val_mpam_memory_mbwumon_read_count(uint32_t msc_index);
+uint64_t val_mpam_wait_mbwumon(uint32_t msc_index, uint32_t timeout_us);
 uint32_t val_mpam_get_msc_count(void);
 uint32_t val_mpam_get_max_ris_count(uint32_t msc_index);
 void val_mpam_memory_mbwumon_reset(uint32_t msc_index);
@@ -144,12 +150,17 @@ void val_mpam_configure_csu_mon(uint32_t msc_index, uint16_t partid, uint8_t pmg
 void val_mpam_csumon_enable(uint32_t msc_index);
 void val_mpam_csumon_disable(uint32_t msc_index);
 uint32_t val_mpam_read_csumon(uint32_t msc_index);
+uint32_t val_mpam_wait_csumon(uint32_t msc_index, uint32_t timeout_us);
 uint64_t val_srat_get_prox_domain(uint64_t mem_range_index);
 uint32_t val_mpam_mmr_read(uint32_t msc_index, uint32_t reg_offset);
 uint64_t val_mpam_mmr_read64(uint32_t msc_index, uint32_t reg_offset);
 void     val_mpam_mmr_write(uint32_t msc_index, uint32_t reg_offset, uint32_t data);
 void     val_mpam_mmr_write64(uint32_t msc_index, uint32_t reg_offset, uint64_t data);
 uint32_t val_mpam_pcc_read(uint32_t msc_index, uint32_t reg_offset);
+uint32_t val_mpam_pcc_read_batch(uint32_t msc_index, const uint32_t *reg_offset, uint32_t *value,
+                                 uint32_t count);
+uint32_t val_mpam_pcc_write_batch(uint32_t msc_index, const uint32_t *reg_offset,
+                                  const uint32_t *data, uint32_t count);
 void     val_mpam_pcc_write(uint32_t msc_index, uint32_t reg_offset, uint32_t data);
 uint32_t val_mpam_program_el2(uint16_t partid, uint8_t pmg);
 uint32_t val_mpam_msc_endis_partid(uint32_t msc_index, bool endis_flag,
@@ -41,6 +41,9 @@
 #define ERR_STATUS_CI_MASK  (0x1 << 19)
 #define ERR_STATUS_CLEAR    (0xFFF80000)
 
+/* Deadline for an injected error to latch in ERR<n>STATUS or raise its interrupt */
+#define RAS_ERR_LATCH_TIMEOUT_US  (100 * ONE_MILLISECOND)
+
 #define ERR_CTLR_CLEAR_MASK     0x3FFD
 #define ERR_CTLR_ED_ENABLE      0x1
 #define ERR_CTLR_FHI_ENABLE     0x108ULL  /* Enable Fault Handling Interrupt */
@@ -109,6 +112,8 @@ typedef enum {
 uint32_t val_ras_setup_error(RAS_ERR_IN_t in_param, RAS_ERR_OUT_t *out_param);
 uint32_t val_ras_inject_error(RAS_ERR_IN_t in_param, RAS_ERR_OUT_t *out_param);
 void val_ras_wait_timeout(uint32_t count);
+uint32_t val_ras_wait_error(uint32_t node_index, volatile uint32_t *intr_pending,
+                            uint32_t timeout_us);
 
 uint32_t val_ras_check_err_record(uint32_t node_index, uint32_t error_type);
 uint32_t val_ras_check_plat_poison_support(void);
@@ -25,6 +25,16 @@
 #define ARM_ARCH_TIMER_IMASK            (1 << 1)
 #define ARM_ARCH_TIMER_ISTATUS          (1 << 2)
 
+/* CNTKCTL_EL1 / CNTHCTL_EL2 event stream fields */
+#define ARM_ARCH_TIMER_EVNTEN           (1 << 2)
+#define ARM_ARCH_TIMER_EVNTDIR          (1 << 3)
+#define ARM_ARCH_TIMER_EVNTI_SHIFT      4
+#define ARM_ARCH_TIMER_EVNTI_MASK       (0xFULL << ARM_ARCH_TIMER_EVNTI_SHIFT)
+#define ARM_ARCH_TIMER_EVNTI_MAX        15
+
+/* Upper bound on how long val_wait_until sleeps in WFE between checks */
+#define VAL_WAIT_EVENT_PERIOD_US        100
+
 typedef enum {
   CntFrq = 0,
   CntPct,
@@ -18,8 +18,6 @@
 #ifndef __ACS_WAKEUP_H__
 #define __ACS_WAKEUP_H__
 
-#define MAX_SPIN_LOOPS 1000000U
-
 uint32_t u001_entry(uint32_t num_pe);
 uint32_t u002_entry(uint32_t num_pe);
 uint32_t u003_entry(uint32_t num_pe);
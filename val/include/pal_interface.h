@@ -924,9 +924,28 @@ typedef enum {
     START_TXN_MONITOR    = 0xb,
     STOP_TXN_MONITOR     = 0xc,
     ATS_TXN_REQ          = 0xd,
-    INJECT_ERROR         = 0xe
+    INJECT_ERROR         = 0xe,
+    START_DMA_BATCH      = 0xf
 } EXERCISER_OPS;
 
+#define EXERCISER_DMA_PENDING   0xFFFFFFFF  /* Transfer not yet processed by the PAL */
+#define EXERCISER_DMA_NO_PASID  0xFFFFFFFF  /* Transfer is sent without a PASID TLP prefix */
+
+/* One transfer of a START_DMA_BATCH request */
+typedef struct {
+    uint64_t addr;       /* Bus address of the buffer in memory */
+    uint32_t len;        /* Transfer length in bytes */
+    uint32_t direction;  /* EDMA_TO_DEVICE or EDMA_FROM_DEVICE */
+    uint32_t pasid;      /* PASID of the transfer or EXERCISER_DMA_NO_PASID */
+    uint32_t status;     /* EXERCISER_DMA_PENDING, then 0 on success */
+} exerciser_dma_xfer_t;
+
+/* START_DMA_BATCH param: transfers are issued in array order */
+typedef struct {
+    uint32_t             count;
+    exerciser_dma_xfer_t *xfer;
+} exerciser_dma_batch_t;
+
 typedef enum {
     ACCESS_TYPE_RD = 0x0,
     ACCESS_TYPE_RW = 0x1
@@ -1283,6 +1302,8 @@ typedef struct {
 #define RETURN_FAILURE         0xFFFFFFFF
 #define PCC_TY3_CMD_OFFSET     12
 #define PCC_TY3_COMM_SPACE     16
+/* Deadline for the platform to complete a PCC command */
+#define PCC_CMD_TIMEOUT_US     (1000 * ONE_MILLISECOND)
 
 void pal_pcc_create_info_table(PCC_INFO_TABLE *PccInfoTable);
 void pal_pcc_store_info(uint32_t subspace_idx);
@@ -1464,6 +1485,9 @@ void pal_pfdi_verify_regs(ARM_SMC_ARGS *ArmSmcArgs, int32_t Conduit,
 #endif
 
 #define LOG_BUFFER_SIZE 8192
+#ifndef DEFERRED_LOG_BUFFER_SIZE
+#define DEFERRED_LOG_BUFFER_SIZE (1024 * 1024)  /* Bytes of binary log kept by deferred logging */
+#endif
 #ifndef static_assert
 #define static_assert _Static_assert
 #endif
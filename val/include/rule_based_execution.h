@@ -27,6 +27,8 @@
 #define RULE_DESC_SIZE   49
 #define INVALID_IDX 0xFFFFFFFF
 #define RULE_REFERENCE_PATH_MAX_DEPTH 10
+#define RULE_PROFILE_PHASE_MAX 32
+#define RULE_PROFILE_TOP_N     10
 
 /* ----------------------------  Struct  Definations --------------------------------------------*/
 
@@ -86,7 +88,7 @@ typedef struct {
 } pfdi_rule_entry_t;
 
 /* ---------------------------- Helper functions declarations ---------------------------------- */
-void     quick_sort_rule_list(RULE_ID_e *rule_list, uint32_t list_size);
+void     sort_rule_list(RULE_ID_e *rule_list, uint32_t list_size, uint32_t *rule_count);
 uint32_t check_module_init(MODULE_NAME_e module_id);
 uint32_t alias_rule_map_get_index(RULE_ID_e alias_rule_id);
 void     print_rule_test_start(uint32_t rule_enum, uint32_t indent);
@@ -100,9 +102,21 @@ bool     rule_reference_path_push(RULE_ID_e rule_id);
 void     rule_reference_path_pop(void);
 const RULE_ID_e *rule_reference_path_get(void);
 
+/* Rule timing profiler (rule_based_profiler.c) */
+void     rule_profile_reset(void);
+void     rule_profile_record(RULE_ID_e rule_id, uint64_t ticks, uint64_t payload_ticks,
+                             bool top_level);
+void     rule_profile_phase_begin(const char8_t *name);
+void     rule_profile_phase_end(void);
+void     rule_profile_print_report(void);
+
 /* ---------------------------- Externs ---------------------------- */
 extern uint32_t rule_status_map[RULE_ID_SENTINEL];
 
+/* Alias plan (rule_alias_plan.c, generated by tools/scripts/gen_alias_plan.py) */
+extern const uint32_t alias_rule_plan_count;
+extern const uint8_t  alias_rule_map_slot[RULE_ID_SENTINEL];
+
 /* Rule lookup tables (defined in rule_lookup.c) */
 extern const bsa_rule_entry_t bsa_rule_list[];
 extern const sbsa_rule_entry_t sbsa_rule_list[];
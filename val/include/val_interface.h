@@ -38,18 +38,22 @@
 /*
  * Note: val_print can be overridden by defining FAST_PRINT_ENABLE in
  * platform_override_fvp.h, provided a FASTPRINT implementation is available
- * in the PAL layer.
+ * in the PAL layer. Messages are still recorded in the deferred log when the
+ * deferred_log policy is set.
  */
 #if defined(TARGET_BAREMETAL) && defined(FAST_PRINT_ENABLE)
 #define val_print(level, ...)                         \
     do {                                              \
+        if (acs_policy_get_deferred_log())            \
+            val_log_deferred((level), __VA_ARGS__);   \
         if ((level) >= acs_policy_get_print_level())  \
             pal_vfastprint(__VA_ARGS__);              \
     } while (0)
 #else
 #define val_print(level, ...)                     \
     do {                                          \
-        if ((level) >= acs_policy_get_print_level()) \
+        if (((level) >= acs_policy_get_print_level()) || \
+            acs_policy_get_deferred_log())        \
             val_printf((level), __VA_ARGS__);     \
     } while (0)
 #endif
@@ -194,6 +198,15 @@ typedef enum {
   V2M_MSI_FLAGS
 } V2M_MSI_INFO_e;
 
+/* One device MSI for val_gic_request_msi_bulk / val_gic_free_msi_bulk */
+typedef struct {
+  uint32_t bdf;
+  uint32_t device_id;
+  uint32_t its_id;
+  uint32_t int_id;
+  uint32_t msi_index;
+} gic_msi_request_t;
+
 uint32_t val_gic_v2m_parse_info(void);
 uint64_t val_gic_v2m_get_info(V2M_MSI_INFO_e type, uint32_t instance);
 void     val_gic_free_info_table(void);
@@ -201,6 +214,7 @@ void     val_gic_cpuif_init(void);
 void     val_gic_free_irq(uint32_t irq_num, uint32_t mapped_irq_num);
 void     val_gic_free_msi(uint32_t bdf, uint32_t device_id, uint32_t its_id,
                           uint32_t int_id, uint32_t msi_index);
+void     val_gic_free_msi_bulk(const gic_msi_request_t *req, uint32_t count);
 uint32_t val_gic_get_info(GIC_INFO_e type);
 uint32_t val_gic_install_isr(uint32_t int_id, void (*isr)(void));
 uint32_t val_gic_end_of_interrupt(uint32_t int_id);
@@ -209,6 +223,7 @@ uint32_t val_gic_its_configure(void);
 uint32_t val_gic_its_get_base(uint32_t its_id, uint64_t *its_base);
 uint32_t val_gic_request_msi(uint32_t bdf, uint32_t device_id, uint32_t its_id,
                              uint32_t int_id, uint32_t msi_index);
+uint32_t val_gic_request_msi_bulk(const gic_msi_request_t *req, uint32_t count);
 
 uint32_t val_bsa_gic_execute_tests(uint32_t num_pe, uint32_t *g_sw_view);
 uint32_t val_gic_route_interrupt_to_pe(uint32_t int_id, uint64_t mpidr);
@@ -253,6 +268,9 @@ uint32_t val_timer_skip_if_cntbase_access_not_allowed(uint64_t index);
 uint64_t val_get_phy_el1_timer_count(void);
 uint32_t val_get_safe_timeout_ticks(void);
 uint64_t val_get_timeout_to_ticks(uint32_t timeout_us);
+uint32_t val_wait_until(uint32_t (*cond)(void *arg), void *arg, uint32_t timeout_us);
+uint32_t val_wait_for_flags(volatile uint32_t *flag1, volatile uint32_t *flag2,
+                            uint32_t timeout_us);
 
 /* Watchdog VAL APIs */
 typedef enum {
@@ -26,7 +26,9 @@ extern "C" {
 
 int val_memory_compare(void *s1, void *s2, uint32_t len);
 
-void *val_memcpy(void *dst, void *src, uint32_t len);
+void *val_memcpy(void *dst, void *src, size_t len);
+
+void *val_memcpy_io(void *dst, void *src, size_t len);
 
 void val_memory_set(void *dst, uint32_t size, uint8_t value);
 
@@ -40,6 +42,9 @@ char *val_strcpy(char *dest, const char *src);
 
 char *val_strncpy(char *dest, const char *src, size_t n);
 
+void val_sort(void *base, uint32_t count, uint32_t size,
+              int (*compare)(const void *, const void *));
+
 #ifdef __cplusplus
 }
 #endif
@@ -31,5 +31,21 @@ uint32_t val_printf(print_verbosity_t verbosity, const char *msg, ...);
 
 void val_mem_copy(char *dest, const char *src, size_t len);
 
+/**
+ *   @brief    - Records a message in the deferred log without printing it
+ *   @param    - verbosity  : Print Verbosity level
+ *   @param    - msg        : Input String
+ *   @param    - ...        : ellipses for variadic args
+ *   @return   - None
+**/
+void val_log_deferred(print_verbosity_t verbosity, const char *msg, ...);
+
+/**
+ *   @brief    - Prints the deferred log buffer as ACS-DLOG hex records, to be
+ *               decoded on the host by tools/scripts/acs_log_decode.py
+ *   @return   - None
+**/
+void val_log_deferred_dump(void);
+
 #endif /* VAL_LOG_H */
 
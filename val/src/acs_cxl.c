@@ -26,6 +26,8 @@
 
 static CXL_INFO_TABLE *g_cxl_info_table;
 static CXL_COMPONENT_TABLE *g_cxl_component_table;
+/* Component capability IDs present in each host bridge CHBCR, one word per host bridge */
+static uint32_t *g_cxl_hb_cap_mask;
 extern pcie_device_bdf_table *g_pcie_bdf_table;
 
 static inline uint64_t
@@ -64,26 +66,23 @@ val_cxl_get_component_entry(uint32_t component_index)
 }
 
 /**
-  @brief   Locate a capability structure within the register block.
+  @brief   Walk the component capability array of a host bridge CHBCR.
 
-  @param  index      Index of the device for which the cap to be identified.
-  @param  cap_id     Capability ID to search for.
+  @param  base  CHBCR base address.
+  @param  mask  Bitmask of the IDs below CXL_CAP_MASK_ID_LIMIT found (may be NULL).
+  @param  cap_id  Capability ID to search for.
 
-  @return 0 if found; else 1.
+  @return 0 if cap_id was found; else 1.
 **/
-uint32_t
-val_cxl_find_comp_capability(uint32_t index, uint32_t cap_id)
+static uint32_t
+val_cxl_walk_comp_capability(uint64_t base, uint32_t *mask, uint32_t cap_id)
 {
-  uint64_t base;
   uint32_t arr_hdr;
   uint32_t entries;
   uint32_t idx;
   uint32_t cap_hdr;
   uint32_t found_id;
-
-  base = val_cxl_get_info(CXL_INFO_COMPONENT_BASE, index);
-  if (base == 0)
-    return 1;
+  uint32_t status = 1;
 
   base = base + CXL_CACHEMEM_PRIMARY_OFFSET;
   arr_hdr = val_mmio_read(base + CXL_COMPONENT_CAP_ARRAY_OFFSET);
@@ -97,13 +96,39 @@ val_cxl_find_comp_capability(uint32_t index, uint32_t cap_id)
 
     found_id = CXL_CAP_HDR_CAPID(cap_hdr);
     val_print(TRACE, "\n       Found id %llx", found_id);
+    if ((mask != NULL) && (found_id < CXL_CAP_MASK_ID_LIMIT))
+      *mask |= (1u << found_id);
     if (found_id == cap_id)
-        return 0;
+      status = 0;
+  }
 
+  return status;
+}
 
-  }
+/**
+  @brief   Locate a capability structure within the register block.
 
-  return 1;
+  The capability array of each host bridge is read once, when the info table
+  is created; later queries are answered from the cached bitmask.
+
+  @param  index      Index of the device for which the cap to be identified.
+  @param  cap_id     Capability ID to search for.
+
+  @return 0 if found; else 1.
+**/
+uint32_t
+val_cxl_find_comp_capability(uint32_t index, uint32_t cap_id)
+{
+  uint64_t base;
+
+  base = val_cxl_get_info(CXL_INFO_COMPONENT_BASE, index);
+  if (base == 0)
+    return 1;
+
+  if ((g_cxl_hb_cap_mask != NULL) && (cap_id < CXL_CAP_MASK_ID_LIMIT))
+    return (g_cxl_hb_cap_mask[index] & (1u << cap_id)) ? 0 : 1;
+
+  return val_cxl_walk_comp_capability(base, NULL, cap_id);
 }
 
 /**
@@ -232,6 +257,39 @@ val_cxl_print_component_summary(void)
   }
 }
 
+/**
+  @brief   Look up the component entry already created for a PCIe function.
+  @param  bdf  PCIe identifier of the device to look up.
+  @return Pointer to the component entry or NULL if the function is not in the table.
+**/
+static CXL_COMPONENT_ENTRY *
+val_cxl_find_component(uint32_t bdf)
+{
+  uint32_t idx;
+
+  if (g_cxl_component_table == NULL)
+    return NULL;
+
+  for (idx = 0; idx < g_cxl_component_table->num_entries; idx++) {
+    if (g_cxl_component_table->component[idx].bdf == bdf)
+      return &g_cxl_component_table->component[idx];
+  }
+
+  return NULL;
+}
+
+/**
+  @brief   Locate a CXL DVSEC in the extended capability list of a function.
+
+  Functions indexed by val_cxl_create_table() are answered from the DVSEC
+  offsets recorded there; others fall back to walking config space.
+
+  @param  bdf         PCIe identifier of the device.
+  @param  cid         CXL DVSEC ID to search for.
+  @param  cid_offset  Config space offset of the DVSEC on success.
+
+  @return 0 if found; else 1.
+**/
 uint32_t
 val_cxl_find_capability(uint32_t bdf, uint32_t cid, uint32_t *cid_offset)
 {
@@ -240,6 +298,15 @@ val_cxl_find_capability(uint32_t bdf, uint32_t cid, uint32_t *cid_offset)
   uint32_t hdr2;
   uint32_t next_cap_offset;
   uint16_t dvsec_id;
+  CXL_COMPONENT_ENTRY *entry;
+
+  entry = val_cxl_find_component(bdf);
+  if ((entry != NULL) && entry->dvsec_indexed && (cid < CXL_DVSEC_ID_INDEX_MAX)) {
+    if (entry->dvsec_offset[cid] == 0)
+      return 1;
+    *cid_offset = entry->dvsec_offset[cid];
+    return 0;
+  }
 
   next_cap_offset = PCIE_ECAP_START;
 
@@ -280,11 +347,9 @@ val_cxl_get_or_create_component(uint32_t bdf)
   if (g_cxl_component_table == NULL)
     return NULL;
 
-  for (idx = 0; idx < g_cxl_component_table->num_entries; idx++) {
-    entry = &g_cxl_component_table->component[idx];
-    if (entry->bdf == bdf)
-      return entry;
-  }
+  entry = val_cxl_find_component(bdf);
+  if (entry != NULL)
+    return entry;
 
   if (g_cxl_component_table->num_entries >= CXL_COMPONENT_TABLE_MAX_ENTRIES)
     return NULL;
@@ -300,6 +365,11 @@ val_cxl_get_or_create_component(uint32_t bdf)
   entry->device_reg_base      = 0;
   entry->device_reg_length    = 0;
   entry->hdm_decoder_count    = 0;
+  entry->cxl_capability       = 0;
+  entry->dvsec_indexed        = 0;
+
+  for (idx = 0; idx < CXL_DVSEC_ID_INDEX_MAX; idx++)
+    entry->dvsec_offset[idx] = 0;
 
   return entry;
 
@@ -896,6 +966,7 @@ static void val_cxl_parse_device_dvsec(uint32_t bdf,
 
     cxl_cap = (uint16_t)((hdr2 >> CXL_DVSEC_CXL_CAPABILITY_SHIFT) &
                          CXL_DVSEC_CXL_CAPABILITY_MASK);
+    component->cxl_capability = cxl_cap;
 
     cache_capable = ((cxl_cap & CXL_DVSEC_CXL_CAP_CACHE_CAPABLE) != 0) ? 1 : 0;
     io_capable = ((cxl_cap & CXL_DVSEC_CXL_CAP_IO_CAPABLE) != 0) ? 1 : 0;
@@ -977,6 +1048,11 @@ val_cxl_device_is_cxl(uint32_t bdf)
   uint32_t prev_off = PCIE_UNKNOWN_RESPONSE;
   uint32_t hdr0;
   uint32_t hdr1;
+  CXL_COMPONENT_ENTRY *entry;
+
+  entry = val_cxl_find_component(bdf);
+  if ((entry != NULL) && entry->dvsec_indexed)
+    return ACS_STATUS_PASS;
 
   while (next_cap_offset) {
     if (next_cap_offset == prev_off)
@@ -1029,6 +1105,7 @@ val_cxl_create_table()
   uint16_t dvsec_id;
   uint32_t found = 0;
   uint32_t tbl_index = 0;
+  CXL_COMPONENT_ENTRY *component;
   pcie_device_bdf_table *bdf_tbl_ptr;
   bdf_tbl_ptr = val_pcie_bdf_table_ptr();
 
@@ -1083,9 +1160,13 @@ val_cxl_create_table()
         dvsec_id = (uint16_t)(hdr2 & CXL_DVSEC_HDR2_ID_MASK);
         found = 1;
 
-        if (val_cxl_get_or_create_component(bdf) == NULL)
+        component = val_cxl_get_or_create_component(bdf);
+        if (component == NULL)
           return ACS_STATUS_ERR;
 
+        if ((dvsec_id < CXL_DVSEC_ID_INDEX_MAX) && (component->dvsec_offset[dvsec_id] == 0))
+          component->dvsec_offset[dvsec_id] = (uint16_t)next_cap_offset;
+
         val_print(TRACE, "\n BDF: 0x%lx  :: ", bdf);
         val_print(TRACE, " Device type : 0x%lx", dp_type);
         val_print(TRACE, " Found CXL DVSEC (ID=0x%x)", dvsec_id);
@@ -1107,6 +1188,10 @@ val_cxl_create_table()
       if (!found)
         return ACS_STATUS_SKIP;
 
+      component = val_cxl_find_component(bdf);
+      if (component != NULL)
+        component->dvsec_indexed = 1;
+
       if (g_cxl_info_table != NULL)
         val_cxl_assign_host_bridge_indices();
 
@@ -1160,13 +1245,23 @@ val_cxl_create_info_table(uint64_t *cxl_info_table)
   if (num_cxl_hb == 0)
     return;
 
+  g_cxl_hb_cap_mask = (uint32_t *)val_memory_alloc(num_cxl_hb * sizeof(uint32_t));
+
   for (index = 0; index < num_cxl_hb; index++) {
     CXL_INFO_BLOCK *entry = &g_cxl_info_table->device[index];
 
+    if (g_cxl_hb_cap_mask != NULL)
+      g_cxl_hb_cap_mask[index] = 0;
+
     if (val_cxl_host_discover_capabilities(entry) != ACS_STATUS_PASS) {
       val_print(ERROR,
                 " CXL_INFO: Failed to map host bridge component window (UID 0x%x)",
                 entry->uid);
+    } else if ((g_cxl_hb_cap_mask != NULL) && (entry->component_reg_base != 0u) &&
+               (entry->component_reg_length != 0u)) {
+      /* Only walk a component window that discovery has just mapped */
+      val_cxl_walk_comp_capability(entry->component_reg_base, &g_cxl_hb_cap_mask[index],
+                                   CXL_CAP_MASK_ID_LIMIT);
     }
 
     val_print(TRACE, " \nCXL_INFO: Host Bridge[%u]\n", index);
@@ -1198,6 +1293,11 @@ val_cxl_free_info_table(void)
 {
     val_cxl_free_component_table();
 
+    if (g_cxl_hb_cap_mask != NULL) {
+        val_memory_free((void *)g_cxl_hb_cap_mask);
+        g_cxl_hb_cap_mask = NULL;
+    }
+
     if (g_cxl_info_table != NULL) {
         val_memory_free_aligned((void *)g_cxl_info_table);
         g_cxl_info_table = NULL;
@@ -1354,6 +1454,12 @@ val_cxl_device_cache_capable(uint32_t bdf)
   uint32_t dvsec_off;
   uint32_t reg_value;
   uint32_t cxl_caps;
+  CXL_COMPONENT_ENTRY *entry;
+
+  entry = val_cxl_find_component(bdf);
+  if ((entry != NULL) && entry->dvsec_indexed &&
+      (entry->dvsec_offset[CXL_DVSEC_ID_DEVICE] != 0))
+    return ((entry->cxl_capability & CXL_DVSEC_CXL_CAP_CACHE_CAPABLE) != 0);
 
   if (val_cxl_find_capability(bdf, CXL_DVSEC_ID_DEVICE, &dvsec_off)) {
       val_print(DEBUG, "DVSEC Capability not found for bdf 0x%x", bdf);
@@ -0,0 +1,460 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+/*
+ * ETE trace packet decoder.
+ *
+ * This file only depends on acs_stdint.h and acs_ete.h so that it can be
+ * compiled unchanged on a Linux host, e.g.
+ *   gcc -O2 -Ival/include -c val/src/acs_ete_decoder.c
+ * and linked into fuzzers or benchmarks fed with captured TRBE buffers.
+ * It must not call into VAL or PAL and must not print.
+ */
+
+#include "acs_stdint.h"
+#include "acs_ete.h"
+
+#define ETE_BIT(data, pos)  (((data) >> (pos)) & 0x1)
+
+/**
+  @brief  Returns the length of a field terminated by a byte with the continuation bit clear.
+
+  @param  pkt        - Start of the packet
+  @param  avail      - Bytes available from pkt to the end of the stream
+  @param  position   - Offset of the field within the packet
+  @param  layout_len - Maximum length of the field
+
+  @return Number of bytes making up the field. If the stream ends inside the
+          field the returned length makes position + length exceed avail.
+**/
+static uint64_t
+ete_cbit_len(const uint8_t *pkt, uint64_t avail, uint64_t position, uint64_t layout_len)
+{
+  uint64_t i = 0;
+
+  while (i < layout_len - 1) {
+      if ((position + i >= avail) || !(pkt[position + i] & CONTINUITY_BIT_MASK))
+          break;
+      i++;
+  }
+
+  return i + 1; /* include the last byte with C=0 */
+}
+
+/**
+  @brief  Decodes packets whose header is not a single fixed value.
+
+  @param  pkt   - Start of the packet
+  @param  avail - Bytes available from pkt to the end of the stream
+  @param  type  - Returns the decoded packet class
+
+  @return Packet length, or 0 for a reserved header
+**/
+static uint64_t
+ete_decode_masked(const uint8_t *pkt, uint64_t avail, uint32_t *type)
+{
+  uint8_t header = pkt[0];
+
+  if ((header & ATOM_FORMAT_X_PKT_MASK) == ATOM_FORMAT_X_PKT_VAL) {
+      *type = ETE_PKT_ATOM;
+      return TRACE_PKT_MIN_LEN;
+  }
+
+  if (((header & CYCLE_COUNT_FORMAT_3_1_MASK) == CYCLE_COUNT_FORMAT_3_1_VAL) ||
+      ((header & CYCLE_COUNT_FORMAT_3_0_MASK) == CYCLE_COUNT_FORMAT_3_0_VAL)) {
+      *type = ETE_PKT_CYCLE_COUNT;
+      return TRACE_PKT_MIN_LEN;
+  }
+
+  if ((header & MISPREDICT_PKT_MASK) == MISPREDICT_PKT_VAL) {
+      *type = ETE_PKT_MISPREDICT;
+      return TRACE_PKT_MIN_LEN;
+  }
+
+  if (((header & CANCEL_FORMAT_2_PKT_MASK) == CANCEL_FORMAT_2_PKT_VAL) ||
+      ((header & CANCEL_FORMAT_3_PKT_MASK) == CANCEL_FORMAT_3_PKT_VAL)) {
+      *type = ETE_PKT_CANCEL;
+      return TRACE_PKT_MIN_LEN;
+  }
+
+  if ((header & EVENT_PKT_MASK) == EVENT_PKT_VAL) {
+      *type = ETE_PKT_EVENT;
+      return TRACE_PKT_MIN_LEN;
+  }
+
+  if ((header & TARGET_ADDR_EXACT_MATCH_MASK) == TARGET_ADDR_EXACT_MATCH_VAL) {
+      *type = ETE_PKT_TARGET_ADDR;
+      return TRACE_PKT_MIN_LEN;
+  }
+
+  if ((header & SRC_ADDR_EXACT_MATCH_MASK) == SRC_ADDR_EXACT_MATCH_VAL) {
+      *type = ETE_PKT_SOURCE_ADDR;
+      return TRACE_PKT_MIN_LEN;
+  }
+
+  if ((header & CANCEL_FORMAT_1_PKT_MASK) == CANCEL_FORMAT_1_PKT_VAL) {
+      *type = ETE_PKT_CANCEL;
+      return 1 + ete_cbit_len(pkt, avail, 1, 5);
+  }
+
+  if ((header & Q_EXACT_MATCH_PKT_MASK) == Q_EXACT_MATCH_PKT_VAL) {
+      *type = ETE_PKT_Q;
+      return 1 + ete_cbit_len(pkt, avail, 1, 5);
+  }
+
+  return 0;
+}
+
+/**
+  @brief  Decodes the variable part of an Exception packet.
+
+  @param  pkt   - Start of the packet
+  @param  avail - Bytes available from pkt to the end of the stream
+
+  @return Packet length, or 0 for a reserved encoding
+**/
+static uint64_t
+ete_decode_exception(const uint8_t *pkt, uint64_t avail)
+{
+  uint64_t len;
+  uint8_t info = pkt[2];
+
+  if (info == 0x70) /* PE Reset or Transaction Failure Packet */
+      return TRACE_SHORT_PKT_LEN;
+
+  if ((info == 0x82) || (info == 0x83) || (info == 0x85) || (info == 0x86)) {
+      len = (info < 0x85) ? TRACE_EXCEPTION_32_PKT_LEN : TRACE_EXCEPTION_64_PKT_LEN;
+      if (len > avail)
+          return len;
+      info = pkt[len - 1];
+      if (ETE_BIT(info, 6))
+          len += VMID_LAYOUT_LEN;
+      if (ETE_BIT(info, 7))
+          len += CONTEXTID_LAYOUT_LEN;
+      return len;
+  }
+
+  switch (info >> 2) {
+  case TRACE_EXACT_MATCH_ADDR_PKT:
+      return TRACE_SHORT_PKT_LEN;
+  case EXCEPTION_SHORT_ADDR_PKT:
+      len = EXCEPTION_SHORT_ADDR_PKT_LEN;
+      if (len > avail)
+          return len;
+      if (!(pkt[len - 2] & CONTINUITY_BIT_MASK))
+          len--;
+      return len;
+  case EXCEPTION_32BIT_ADDR_PKT:
+      return EXCEPTION_32_ADDR_PKT_LEN;
+  case EXCEPTION_64BIT_ADDR_PKT:
+      return EXCEPTION_64_ADDR_PKT_LEN;
+  default:
+      return 0;
+  }
+}
+
+/**
+  @brief  Initialises a decoder over a captured trace stream.
+
+  @param  dec     - Decoder state
+  @param  stream  - Pointer to the raw trace byte stream
+  @param  size    - Size of the stream in bytes
+  @param  commopt - TRCIDR0.COMMOPT of the PE which generated the trace
+
+  @return None
+**/
+void
+val_ete_decoder_init(ETE_DECODER *dec, const uint8_t *stream, uint64_t size, uint32_t commopt)
+{
+  dec->stream  = stream;
+  dec->size    = size;
+  dec->offset  = 0;
+  dec->commopt = commopt;
+}
+
+/**
+  @brief  Decodes the next packet of the stream and advances the decoder past it.
+
+          The decoder classifies each packet from its header byte and computes
+          its length; payloads are left in place and can be read through
+          pkt->offset.
+
+  @param  dec - Decoder state
+  @param  pkt - Returns the decoded packet
+
+  @return ETE_DECODE_OK, ETE_DECODE_END, ETE_DECODE_TRUNCATED or ETE_DECODE_INVALID
+**/
+uint32_t
+val_ete_decode_next(ETE_DECODER *dec, ETE_PACKET *pkt)
+{
+  const uint8_t *p;
+  uint64_t avail;
+  uint64_t len = 0;
+  uint32_t type = ETE_PKT_TYPE_MAX;
+  uint8_t header;
+
+  if (dec->offset >= dec->size)
+      return ETE_DECODE_END;
+
+  p = dec->stream + dec->offset;
+  avail = dec->size - dec->offset;
+  header = p[0];
+
+  switch (header) {
+  case TRACE_ALIGNMENT_PKT:
+      if (avail < 2)
+          return ETE_DECODE_TRUNCATED;
+      if (p[1] & 0x7) {
+          type = ETE_PKT_DISCARD_OVERFLOW;
+          len = DISCARD_OVERFLOW_PKT_LEN;
+      } else {
+          type = ETE_PKT_ALIGN_SYNC;
+          len = ALIGN_SYNC_PKT_LEN;
+      }
+      break;
+
+  case TRACE_INFO_PKT:
+      if (avail < 2)
+          return ETE_DECODE_TRUNCATED;
+      type = ETE_PKT_TRACE_INFO;
+      len = TRACE_INFO_PKT_LEN;
+      if (ETE_BIT(p[1], 0))
+          len += CC_LAYOUT_LEN;
+      if (ETE_BIT(p[1], 2))
+          len += ete_cbit_len(p, avail, len, SPEC_LAYOUT_LEN);
+      if (ETE_BIT(p[1], 3))
+          len += ete_cbit_len(p, avail, len, CYCT_LAYOUT_LEN);
+      break;
+
+  case TRACE_TIMESTAMP_V1_PKT:
+  case TRACE_TIMESTAMP_V2_PKT:
+      type = ETE_PKT_TIMESTAMP;
+      len = 1 + ete_cbit_len(p, avail, 1, TS_FIELD_LAYOUT_LEN);
+      if (ETE_BIT(header, 0))
+          len += ete_cbit_len(p, avail, len, TS_CC_LAYOUT_LEN);
+      break;
+
+  case TRACE_TIMESTAMP_MARKER_PKT:
+      type = ETE_PKT_TIMESTAMP_MARKER;
+      len = TRACE_PKT_MIN_LEN;
+      break;
+
+  case TRACE_TRACE_ON_PKT:
+      type = ETE_PKT_TRACE_ON;
+      len = TRACE_PKT_MIN_LEN;
+      break;
+
+  case TRACE_TRANSACTION_START_PKT:
+  case TRACE_TRANSACTION_COMMIT_PKT:
+      type = ETE_PKT_TRANSACTION;
+      len = TRACE_PKT_MIN_LEN;
+      break;
+
+  case TRACE_IGNORE_PKT:
+      type = ETE_PKT_IGNORE;
+      len = TRACE_PKT_MIN_LEN;
+      break;
+
+  case TRACE_CONTEXT_SAME_PKT:
+      type = ETE_PKT_CONTEXT;
+      len = TRACE_PKT_MIN_LEN;
+      break;
+
+  case TRACE_Q_PKT:
+      type = ETE_PKT_Q;
+      len = TRACE_PKT_MIN_LEN;
+      break;
+
+  case TRACE_EXCEPTION_PKT:
+      if (avail < 3)
+          return ETE_DECODE_TRUNCATED;
+      type = ETE_PKT_EXCEPTION;
+      len = ete_decode_exception(p, avail);
+      break;
+
+  case TRACE_INSTRUMENT_PKT:
+      type = ETE_PKT_INSTRUMENT;
+      len = TRACE_INSTRUMENT_PKT_LEN;
+      break;
+
+  case TRACE_CC_F2_0_SMALL_COMMIT_PKT:
+  case TRACE_CC_F2_1_PKT:
+      type = ETE_PKT_CYCLE_COUNT;
+      len = TRACE_CC_F2_PKT_LEN;
+      break;
+
+  case TRACE_CC_F1_X_COUNT_PKT:
+      type = ETE_PKT_CYCLE_COUNT;
+      if (dec->commopt) {
+          /* Cycle Count Format 1_1 */
+          len = 1 + ete_cbit_len(p, avail, 1, 3);
+      } else {
+          /* Cycle Count Format 1_0 */
+          len = 1 + ete_cbit_len(p, avail, 1, 5);
+          len += ete_cbit_len(p, avail, len, 3);
+      }
+      break;
+
+  case TRACE_CC_F1_X_UNK_COUNT_PKT:
+      type = ETE_PKT_CYCLE_COUNT;
+      if (dec->commopt)
+          len = 1;
+      else
+          len = 1 + ete_cbit_len(p, avail, 1, 5);
+      break;
+
+  case TRACE_COMMIT_PKT:
+      type = ETE_PKT_COMMIT;
+      len = 1 + ete_cbit_len(p, avail, 1, 5);
+      break;
+
+  case TRACE_CONTEXT_PKT:
+  case CTX_32BIT_IS0_PKT:
+  case CTX_32BIT_IS1_PKT:
+  case CTX_64BIT_IS0_PKT:
+  case CTX_64BIT_IS1_PKT:
+      type = (header == TRACE_CONTEXT_PKT) ? ETE_PKT_CONTEXT : ETE_PKT_TARGET_ADDR;
+      if (header == TRACE_CONTEXT_PKT)
+          len = 2;
+      else if ((header == CTX_32BIT_IS0_PKT) || (header == CTX_32BIT_IS1_PKT))
+          len = 6;
+      else
+          len = 10;
+
+      if (len > avail)
+          return ETE_DECODE_TRUNCATED;
+
+      /* Bits [7:6] of the context info byte select the VMID and CONTEXTID layouts */
+      header = p[len - 1];
+      if (ETE_BIT(header, 6))
+          len += VMID_LAYOUT_LEN;
+      if (ETE_BIT(header, 7))
+          len += CONTEXTID_LAYOUT_LEN;
+      header = p[0];
+      break;
+
+  case TARGET_ADDR_SHORT_IS0_PKT:
+  case TARGET_ADDR_SHORT_IS1_PKT:
+  case SRC_SHORT_ADDR_IS0_PKT:
+  case SRC_SHORT_ADDR_IS1_PKT:
+      type = (header < SRC_SHORT_ADDR_IS0_PKT) ? ETE_PKT_TARGET_ADDR : ETE_PKT_SOURCE_ADDR;
+      len = TRACE_SHORT_PKT_LEN;
+      if (len > avail)
+          return ETE_DECODE_TRUNCATED;
+      if (!(p[len - 2] & CONTINUITY_BIT_MASK))
+          len--;
+      break;
+
+  case TARGET_ADDR_32BIT_IS0_PKT:
+  case TARGET_ADDR_32BIT_IS1_PKT:
+      type = ETE_PKT_TARGET_ADDR;
+      len = TARGET_ADDR_32BIT_ISX_PKT_LEN;
+      break;
+
+  case TARGET_ADDR_64BIT_IS0_PKT:
+  case TARGET_ADDR_64BIT_IS1_PKT:
+      type = ETE_PKT_TARGET_ADDR;
+      len = TARGET_ADDR_64BIT_ISX_PKT_LEN;
+      break;
+
+  case Q_SHORT_ADDR_IS0_PKT:
+  case Q_SHORT_ADDR_IS1_PKT:
+      type = ETE_PKT_Q;
+      len = TRACE_SHORT_PKT_LEN;
+      if (len > avail)
+          return ETE_DECODE_TRUNCATED;
+      if (!(p[len - 2] & CONTINUITY_BIT_MASK))
+          len--;
+      len += ete_cbit_len(p, avail, len, 5);
+      break;
+
+  case Q_32BIT_ADDR_IS0_PKT:
+  case Q_32BIT_ADDR_IS1_PKT:
+      type = ETE_PKT_Q;
+      len = Q_32BIT_ADDR_IS0_PKT_A_LEN + ete_cbit_len(p, avail, Q_32BIT_ADDR_IS0_PKT_A_LEN, 5);
+      break;
+
+  case Q_COUNT_PKT:
+      type = ETE_PKT_Q;
+      len = 1 + ete_cbit_len(p, avail, 1, 5);
+      break;
+
+  case SRC_32BIT_ADDR_IS0_PKT:
+  case SRC_32BIT_ADDR_IS1_PKT:
+      type = ETE_PKT_SOURCE_ADDR;
+      len = SRC_32BIT_ADDR_PKT_LEN;
+      break;
+
+  case SRC_64BIT_ADDR_IS0_PKT:
+  case SRC_64BIT_ADDR_IS1_PKT:
+      type = ETE_PKT_SOURCE_ADDR;
+      len = SRC_64BIT_ADDR_PKT_LEN;
+      break;
+
+  default:
+      len = ete_decode_masked(p, avail, &type);
+      break;
+  }
+
+  if (len == 0)
+      return ETE_DECODE_INVALID;
+
+  if (len > avail)
+      return ETE_DECODE_TRUNCATED;
+
+  pkt->type   = type;
+  pkt->header = header;
+  pkt->offset = dec->offset;
+  pkt->length = len;
+
+  dec->offset += len;
+  return ETE_DECODE_OK;
+}
+
+/**
+  @brief  Extracts the timestamp value carried by a Timestamp packet.
+
+  @param  stream - Stream the packet was decoded from
+  @param  pkt    - Packet returned by val_ete_decode_next with type ETE_PKT_TIMESTAMP
+
+  @return Timestamp value, 0 if pkt is not a Timestamp packet
+**/
+uint64_t
+val_ete_decode_timestamp(const uint8_t *stream, const ETE_PACKET *pkt)
+{
+  const uint8_t *field;
+  uint64_t timestamp = 0;
+  uint32_t i;
+
+  if (pkt->type != ETE_PKT_TIMESTAMP)
+      return 0;
+
+  field = stream + pkt->offset + 1;
+
+  /* Bytes 0-7 carry 7 value bits each, byte 8 carries a full 8 bits */
+  for (i = 0; i < TS_FIELD_LAYOUT_LEN; i++) {
+      if (i == TS_FIELD_LAYOUT_LEN - 1) {
+          timestamp |= (uint64_t)field[i] << (7 * i);
+          break;
+      }
+      timestamp |= (uint64_t)(field[i] & TS_VALUE_MASK) << (7 * i);
+      if (!(field[i] & CONTINUITY_BIT_MASK))
+          break;
+  }
+
+  return timestamp;
+}
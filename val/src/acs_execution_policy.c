@@ -97,3 +97,13 @@ uint32_t acs_policy_get_el1skiptrap_mask(void)
 {
     return g_execution_policy.el1skiptrap_mask;
 }
+
+uint32_t acs_policy_get_profile_format(void)
+{
+    return g_execution_policy.profile_format;
+}
+
+uint32_t acs_policy_get_deferred_log(void)
+{
+    return g_execution_policy.deferred_log;
+}
@@ -260,6 +260,68 @@ uint32_t val_exerciser_ops(EXERCISER_OPS ops, uint64_t param, uint32_t instance)
     return status;
 }
 
+/**
+  @brief   This API issues a list of DMA transfers using the PCIe stimulus generation hardware.
+           The whole list is handed to the PAL as one START_DMA_BATCH operation; transfers the
+           PAL leaves pending are issued one at a time with DMA_ATTRIBUTES and START_DMA.
+           PASID TLP prefixes are disabled on return.
+  @param   xfer         - Transfers to issue, in order. status is filled for each entry
+  @param   count        - Number of entries in xfer
+  @param   instance     - Stimulus hardware instance number
+  @return  status       - Number of transfers that failed, 0 if all succeeded
+**/
+uint32_t val_exerciser_dma_batch(exerciser_dma_xfer_t *xfer, uint32_t count, uint32_t instance)
+{
+    uint32_t idx;
+    uint32_t failed = 0;
+    uint32_t pasid_active = 0;
+    exerciser_dma_batch_t batch;
+
+    if ((xfer == NULL) || (count == 0))
+        return 0;
+
+    for (idx = 0; idx < count; idx++)
+        xfer[idx].status = EXERCISER_DMA_PENDING;
+
+    batch.count = count;
+    batch.xfer = xfer;
+    val_exerciser_ops(START_DMA_BATCH, (uint64_t)&batch, instance);
+
+    for (idx = 0; idx < count; idx++) {
+        if (xfer[idx].status != EXERCISER_DMA_PENDING)
+            continue;
+
+        /* Sequential fallback for transfers the PAL did not take */
+        if (xfer[idx].pasid != EXERCISER_DMA_NO_PASID) {
+            xfer[idx].status = val_exerciser_ops(PASID_TLP_START, xfer[idx].pasid, instance);
+            pasid_active = 1;
+        } else if (pasid_active) {
+            xfer[idx].status = val_exerciser_ops(PASID_TLP_STOP, 0, instance);
+            pasid_active = 0;
+        } else {
+            xfer[idx].status = 0;
+        }
+
+        if (xfer[idx].status == 0)
+            xfer[idx].status = val_exerciser_set_param(DMA_ATTRIBUTES, xfer[idx].addr,
+                                                       xfer[idx].len, instance);
+        if (xfer[idx].status == 0)
+            xfer[idx].status = val_exerciser_ops(START_DMA, xfer[idx].direction, instance);
+    }
+
+    if (pasid_active && val_exerciser_ops(PASID_TLP_STOP, 0, instance))
+        val_print(WARN, "\n       Exerciser %x PASID TLP Prefix disable error", instance);
+
+    for (idx = 0; idx < count; idx++) {
+        if (xfer[idx].status != 0) {
+            val_print(DEBUG, "\n       DMA transfer %d failed", idx);
+            failed++;
+        }
+    }
+
+    return failed;
+}
+
 /**
   @brief   This API returns test specific data from the PCIe stimulus generation hardware
   @param   type         - data type for which the data needs to be returned
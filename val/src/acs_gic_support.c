@@ -23,6 +23,7 @@
 #include "acs_iovirt.h"
 #include "acs_exception.h"
 #include "acs_gic_its.h"
+#include "acs_memory.h"
 #include "gic.h"
 #include "pal_interface.h"
 
@@ -458,95 +459,241 @@ static uint32_t fill_msi_table(uint32_t bdf, uint64_t msi_addr, uint32_t msi_dat
 }
 
 /**
-  @brief   This function clear the MSI related mappings.
+  @brief   Look up the ITS index of every request in a bulk MSI list and check
+           that the GIC is set up for LPIs.
 
-  @param   bdf          B:D:F for the device
-  @param   int_id       Interrupt ID
-  @param   msi_index    msi index in the table
+  @param   req          List of MSI requests
+  @param   count        Number of entries in req
+  @param   its_index    Filled with the ITS index of each request
 
   @return  status
 **/
-void val_gic_free_msi(uint32_t bdf, uint32_t device_id, uint32_t its_id,
-                      uint32_t int_id, uint32_t msi_index)
+static uint32_t
+gic_msi_its_index(const gic_msi_request_t *req, uint32_t count, uint32_t *its_index)
 {
-  uint32_t its_index;
-  uint32_t msi_cap_offset;
+  uint32_t i;
 
-  its_index = get_its_index(its_id);
-  if (its_index >= g_gic_its_info->GicNumIts)
-  {
-    val_print(ERROR, "\n       Could not find ITS ID [%x]", its_id);
-    return;
-  }
+  if ((g_gic_its_info == NULL) || (g_gic_its_info->GicNumIts == 0))
+    return ACS_STATUS_ERR;
 
   if ((g_gic_its_info->GicRdBase == 0) || (g_gic_its_info->GicDBase == 0))
   {
-    val_print(ERROR, "\n       GICD/GICRD Base Invalid value");
+    val_print(DEBUG, "\n       GICD/GICRD Base Invalid value");
+    return ACS_STATUS_ERR;
+  }
+
+  for (i = 0; i < count; i++) {
+    its_index[i] = get_its_index(req[i].its_id);
+    if (its_index[i] >= g_gic_its_info->GicNumIts) {
+      val_print(ERROR, "\n       Could not find ITS ID [%x]", req[i].its_id);
+      return ACS_STATUS_ERR;
+    }
+  }
+
+  return ACS_STATUS_PASS;
+}
+
+/**
+  @brief   Gather the requests routed through one ITS into an ITS mapping list.
+
+  @param   req          List of MSI requests
+  @param   its_index    ITS index of each request
+  @param   count        Number of entries in req
+  @param   first        Request whose ITS is gathered
+  @param   map          Filled with the (DeviceID, LPI) pairs of that ITS
+
+  @return  Number of entries written to map, 0 if an earlier request already
+           gathered this ITS
+**/
+static uint32_t
+gic_msi_gather_its(const gic_msi_request_t *req, const uint32_t *its_index, uint32_t count,
+                   uint32_t first, its_lpi_map_t *map)
+{
+  uint32_t i;
+  uint32_t num = 0;
+
+  for (i = 0; i < first; i++) {
+    if (its_index[i] == its_index[first])
+      return 0;
+  }
+
+  for (i = first; i < count; i++) {
+    if (its_index[i] != its_index[first])
+      continue;
+    map[num].device_id = req[i].device_id;
+    map[num].int_id    = req[i].int_id;
+    num++;
+  }
+
+  return num;
+}
+
+/**
+  @brief   This function clears the MSI related mappings for a list of devices.
+           The ITS mappings are removed with one command batch per ITS, then the
+           MSI-X/MSI table of each device is cleared.
+
+  @param   req          List of MSI requests passed to val_gic_request_msi_bulk
+  @param   count        Number of entries in req
+
+  @return  None
+**/
+void val_gic_free_msi_bulk(const gic_msi_request_t *req, uint32_t count)
+{
+  uint32_t i;
+  uint32_t num;
+  uint32_t msi_cap_offset;
+  uint32_t *its_index;
+  its_lpi_map_t *map;
+
+  if ((req == NULL) || (count == 0))
     return;
+
+  its_index = val_memory_calloc(count, sizeof(uint32_t));
+  map = val_memory_calloc(count, sizeof(its_lpi_map_t));
+  if ((its_index == NULL) || (map == NULL)) {
+    val_print(ERROR, "\n       Allocation for MSI list failed");
+    goto free_lists;
+  }
+
+  if (gic_msi_its_index(req, count, its_index))
+    goto free_lists;
+
+  for (i = 0; i < count; i++) {
+    num = gic_msi_gather_its(req, its_index, count, i, map);
+    if (num)
+      val_its_clear_lpi_map_bulk(its_index[i], map, num);
   }
 
-  val_its_clear_lpi_map(its_index, device_id, int_id);
   /* Get MSI-X/MSI Capability Offset */
-  if (!(val_pcie_find_capability(bdf, PCIE_CAP, CID_MSIX, &msi_cap_offset)))
-    clear_msi_x_table(bdf, msi_index, msi_cap_offset);
-  else if (!(val_pcie_find_capability(bdf, PCIE_CAP, CID_MSI, &msi_cap_offset)))
-    clear_msi_table(bdf, msi_cap_offset);
+  for (i = 0; i < count; i++) {
+    if (!(val_pcie_find_capability(req[i].bdf, PCIE_CAP, CID_MSIX, &msi_cap_offset)))
+      clear_msi_x_table(req[i].bdf, req[i].msi_index, msi_cap_offset);
+    else if (!(val_pcie_find_capability(req[i].bdf, PCIE_CAP, CID_MSI, &msi_cap_offset)))
+      clear_msi_table(req[i].bdf, msi_cap_offset);
+  }
+
+free_lists:
+  if (map != NULL)
+    val_memory_free(map);
+  if (its_index != NULL)
+    val_memory_free(its_index);
 }
 
 /**
-  @brief   This function creates the MSI mappings, and programs the MSI Table.
+  @brief   This function clear the MSI related mappings.
 
   @param   bdf          B:D:F for the device
-  @param   device_id    Device ID
-  @param   its_id       ITS ID
   @param   int_id       Interrupt ID
   @param   msi_index    msi index in the table
 
   @return  status
 **/
-uint32_t val_gic_request_msi(uint32_t bdf, uint32_t device_id, uint32_t its_id,
-                             uint32_t int_id, uint32_t msi_index)
+void val_gic_free_msi(uint32_t bdf, uint32_t device_id, uint32_t its_id,
+                      uint32_t int_id, uint32_t msi_index)
+{
+  gic_msi_request_t req;
+
+  req.bdf       = bdf;
+  req.device_id = device_id;
+  req.its_id    = its_id;
+  req.int_id    = int_id;
+  req.msi_index = msi_index;
+  val_gic_free_msi_bulk(&req, 1);
+}
+
+/**
+  @brief   This function creates the MSI mappings for a list of devices, and
+           programs the MSI Table of each. The ITS mappings are created with one
+           command batch per ITS instead of one per device.
+
+  @param   req          List of MSI requests
+  @param   count        Number of entries in req
+
+  @return  status of the first request that could not be completed, PASS
+           if all were programmed. SKIP means a device has no MSI-X/MSI
+           capability. The caller frees the list with val_gic_free_msi_bulk
+           in every case.
+**/
+uint32_t val_gic_request_msi_bulk(const gic_msi_request_t *req, uint32_t count)
 {
+  uint32_t i;
+  uint32_t num;
   uint32_t status;
   uint64_t msi_addr;
   uint32_t msi_data;
-  uint32_t its_index;
   uint32_t msi_cap_offset;
+  uint32_t *its_index;
+  its_lpi_map_t *map;
 
-   if ((g_gic_its_info == NULL) || (g_gic_its_info->GicNumIts == 0))
+  if ((req == NULL) || (count == 0))
     return ACS_STATUS_ERR;
 
-  its_index = get_its_index(its_id);
+  its_index = val_memory_calloc(count, sizeof(uint32_t));
+  map = val_memory_calloc(count, sizeof(its_lpi_map_t));
+  if ((its_index == NULL) || (map == NULL)) {
+    val_print(ERROR, "\n       Allocation for MSI list failed");
+    status = ACS_STATUS_ERR;
+    goto free_lists;
+  }
 
-  if (its_index >= g_gic_its_info->GicNumIts) {
-    val_print(ERROR, "\n       Could not find ITS ID [%x]", its_id);
-    return ACS_STATUS_ERR;
+  status = gic_msi_its_index(req, count, its_index);
+  if (status)
+    goto free_lists;
+
+  for (i = 0; i < count; i++) {
+    num = gic_msi_gather_its(req, its_index, count, i, map);
+    if (num)
+      val_its_create_lpi_map_bulk(its_index[i], map, num, LPI_PRIORITY1);
   }
 
-  if ((g_gic_its_info->GicRdBase == 0) || (g_gic_its_info->GicDBase == 0))
-  {
-    val_print(DEBUG, "\n       GICD/GICRD Base Invalid value");
-    return ACS_STATUS_ERR;
+  for (i = 0; i < count; i++) {
+    msi_addr = val_its_get_translater_addr(its_index[i]);
+    msi_data = req[i].int_id - ARM_LPI_MINID;
+
+    /* Get MSI-X/MSI Capability Offset */
+    if (!(val_pcie_find_capability(req[i].bdf, PCIE_CAP, CID_MSIX, &msi_cap_offset)))
+      status = fill_msi_x_table(req[i].bdf, req[i].msi_index, msi_addr, msi_data,
+                                msi_cap_offset);
+    else if (!(val_pcie_find_capability(req[i].bdf, PCIE_CAP, CID_MSI, &msi_cap_offset)))
+      status = fill_msi_table(req[i].bdf, msi_addr, msi_data, msi_cap_offset);
+    else
+      status = ACS_STATUS_SKIP;
+
+    if (status)
+      break;
   }
 
-  val_its_create_lpi_map(its_index, device_id, int_id, LPI_PRIORITY1);
+free_lists:
+  if (map != NULL)
+    val_memory_free(map);
+  if (its_index != NULL)
+    val_memory_free(its_index);
+  return status;
+}
 
-  msi_addr = val_its_get_translater_addr(its_index);
-  msi_data = int_id-ARM_LPI_MINID;
+/**
+  @brief   This function creates the MSI mappings, and programs the MSI Table.
 
-  /* Get MSI-X/MSI Capability Offset */
-  if (!(val_pcie_find_capability(bdf, PCIE_CAP, CID_MSIX, &msi_cap_offset)))
-  {
-    status = fill_msi_x_table(bdf, msi_index, msi_addr, msi_data, msi_cap_offset);
-    return status;
-  }
-  else if (!(val_pcie_find_capability(bdf, PCIE_CAP, CID_MSI, &msi_cap_offset)))
-  {
-    status = fill_msi_table(bdf, msi_addr, msi_data, msi_cap_offset);
-    return status;
-  }
-  else
-    return ACS_STATUS_SKIP;
+  @param   bdf          B:D:F for the device
+  @param   device_id    Device ID
+  @param   its_id       ITS ID
+  @param   int_id       Interrupt ID
+  @param   msi_index    msi index in the table
+
+  @return  status
+**/
+uint32_t val_gic_request_msi(uint32_t bdf, uint32_t device_id, uint32_t its_id,
+                             uint32_t int_id, uint32_t msi_index)
+{
+  gic_msi_request_t req;
+
+  req.bdf       = bdf;
+  req.device_id = device_id;
+  req.its_id    = its_id;
+  req.int_id    = int_id;
+  req.msi_index = msi_index;
+  return val_gic_request_msi_bulk(&req, 1);
 }
 
 /**
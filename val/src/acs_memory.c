@@ -27,6 +27,10 @@
 MEMORY_INFO_TABLE  *g_memory_info_table;
 extern IOREMMAP_LIST *ioremmap_list;
 
+/* Memory info table entry indices sorted by phy_addr, for val_memory_get_info */
+static uint32_t *g_memory_addr_index;
+static uint32_t g_memory_addr_index_count;
+
 #define SIZE_4KB   0x00001000
 
 #define ADDR_52BIT_MASK 0xFFFFFFFFFFFFULL
@@ -67,6 +71,101 @@ uint32_t val_mmu_get_mapping_count(void)
 #endif  // TARGET_BAREMETAL
 
 #ifndef TARGET_LINUX
+/**
+  @brief  val_sort comparison for the memory address index. Orders entries
+          by base address and then by table position.
+
+  @param  a  Pointer to first table index
+  @param  b  Pointer to second table index
+
+  @return <0, 0 or >0 as entry a sorts before, with or after entry b
+**/
+static int
+val_memory_addr_index_compare(const void *a, const void *b)
+{
+  uint32_t ia = *(const uint32_t *)a;
+  uint32_t ib = *(const uint32_t *)b;
+  uint64_t pa = g_memory_info_table->info[ia].phy_addr;
+  uint64_t pb = g_memory_info_table->info[ib].phy_addr;
+
+  if (pa != pb)
+      return (pa < pb) ? -1 : 1;
+
+  return (ia < ib) ? -1 : (ia > ib);
+}
+
+/**
+  @brief  Free the memory address index built by val_memory_build_addr_index
+
+  @param  None
+
+  @return None
+**/
+static void
+val_memory_free_addr_index(void)
+{
+  if (g_memory_addr_index != NULL) {
+      val_memory_free(g_memory_addr_index);
+      g_memory_addr_index = NULL;
+  }
+  g_memory_addr_index_count = 0;
+}
+
+/**
+  @brief  Build an index of the memory info table sorted by base address, so
+          val_memory_get_info can binary search it.
+
+          val_memory_get_info returns the first matching entry in table order.
+          With overlapping entries the sorted order cannot give that answer
+          directly, so no index is kept and lookups stay linear.
+
+  @param  None
+
+  @return None
+**/
+static void
+val_memory_build_addr_index(void)
+{
+  uint32_t count = 0;
+  uint32_t i;
+  uint64_t end, max_end = 0;
+  MEM_INFO_BLOCK *entry;
+
+  val_memory_free_addr_index();
+
+  while (g_memory_info_table->info[count].type != MEMORY_TYPE_LAST_ENTRY)
+      count++;
+
+  if (count < 2)
+      return;
+
+  g_memory_addr_index = val_memory_alloc(count * sizeof(uint32_t));
+  if (g_memory_addr_index == NULL) {
+      val_print(DEBUG, "\n       Memory address index allocation failed");
+      return;
+  }
+
+  for (i = 0; i < count; i++)
+      g_memory_addr_index[i] = i;
+
+  val_sort(g_memory_addr_index, count, sizeof(uint32_t), val_memory_addr_index_compare);
+
+  for (i = 0; i < count; i++) {
+      entry = &g_memory_info_table->info[g_memory_addr_index[i]];
+      if (entry->phy_addr < max_end) {
+          val_print(TRACE, "\n       Memory map entries overlap at 0x%llx", entry->phy_addr);
+          val_memory_free_addr_index();
+          return;
+      }
+
+      end = entry->phy_addr + entry->size;
+      if (end > max_end)
+          max_end = end;
+  }
+
+  g_memory_addr_index_count = count;
+}
+
 /**
   @brief  Free the memory allocated for the Memory Info table
 
@@ -77,6 +176,8 @@ uint32_t val_mmu_get_mapping_count(void)
 void
 val_memory_free_info_table(void)
 {
+    val_memory_free_addr_index();
+
     if (g_memory_info_table != NULL) {
         pal_mem_free((void *)g_memory_info_table);
         g_memory_info_table = NULL;
@@ -106,6 +207,7 @@ val_memory_create_info_table(uint64_t *memory_info_table)
 
   pal_memory_create_info_table(g_memory_info_table);
 
+  val_memory_build_addr_index();
 }
 #endif
 
@@ -151,6 +253,32 @@ val_memory_get_info(addr_t addr, uint64_t *attr)
 {
 
   uint32_t index = 0;
+  uint32_t lo, hi, mid;
+  MEM_INFO_BLOCK *entry;
+
+  if (g_memory_addr_index != NULL) {
+      /* Find the last entry starting at or below addr */
+      lo = 0;
+      hi = g_memory_addr_index_count;
+      while (lo < hi) {
+          mid = lo + (hi - lo) / 2;
+          if (g_memory_info_table->info[g_memory_addr_index[mid]].phy_addr <= addr)
+              lo = mid + 1;
+          else
+              hi = mid;
+      }
+
+      /* Entries do not overlap, so only that entry can contain addr */
+      if (lo != 0) {
+          entry = &g_memory_info_table->info[g_memory_addr_index[lo - 1]];
+          if (addr < (entry->phy_addr + entry->size)) {
+              *attr = entry->flags;
+              return entry->type;
+          }
+      }
+
+      return MEM_TYPE_NOT_POPULATED;
+  }
 
   while (g_memory_info_table->info[index].type != MEMORY_TYPE_LAST_ENTRY) {
       if ((addr >= g_memory_info_table->info[index].phy_addr) &&
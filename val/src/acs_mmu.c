@@ -24,23 +24,46 @@
 
 static uint32_t log2_func(uint64_t size);
 
+/* Translation regime parameters shared by every walk of the TTBR0 tables */
+typedef struct {
+  uint64_t ttbr;
+  uint64_t tt_base_phys;
+  uint32_t ias;
+  uint32_t page_size_log2;
+  uint32_t bits_per_level;
+  uint32_t start_level;
+  uint32_t start_bits_remaining;
+  uint32_t start_bits_at_level;
+} mmu_walk_geom_t;
+
+/* Last table a walk descended into. A lookup for an address covered by the
+   same table starts there instead of at TTBR0, provided TTBR0 and the table
+   descriptor that pointed to it are unchanged. */
+static struct {
+  uint64_t ttbr;
+  uint64_t *parent_entry;
+  uint64_t parent_value;
+  uint64_t va_base;
+  uint64_t va_mask;
+  uint64_t tt_base_phys;
+  uint32_t level;
+  uint32_t bits_remaining;
+  uint32_t bits_at_this_level;
+  uint32_t valid;
+} mmu_walk_cache;
+
 /**
-  @brief   This API will check whether inputted base address is already
-           mapped in the translation table or not.
+  @brief   Read TCR and TTBR0 and derive the starting point of a table walk.
 
-  @param   addr - address to be checked.
+  @param   geom - walk parameters to fill.
 
-  @return  0 - if mmu entry is present, 1 otherwise.
+  @return  0 - on success, 1 otherwise.
 **/
-uint32_t
-val_mmu_check_for_entry(uint64_t addr)
+static uint32_t
+mmu_walk_geometry(mmu_walk_geom_t *geom)
 {
   PE_TCR_BF tcr;
-  uint64_t ttbr, ttable_entry;
-  uint64_t tt_base_phys, *tt_base_virt;
-  uint32_t ias, index, num_pgt_levels, this_level;
-  uint32_t page_size_log2, bits_per_level, page_size;
-  uint32_t bits_at_this_level, bits_remaining;
+  uint32_t num_pgt_levels;
 
   /* Get translation attributes from TCR and translation table base from TTBR
      TTBR0 is used since we are accessing lower address region */
@@ -49,93 +72,223 @@ val_mmu_check_for_entry(uint64_t addr)
       return 1;
   }
 
-  if (val_pe_reg_read_ttbr(0 /*TTBR0*/, &ttbr)) {
+  if (val_pe_reg_read_ttbr(0 /*TTBR0*/, &geom->ttbr)) {
       val_print(ERROR, "\n   Failed to fetch TTBR0");
       return 1;
   }
 
-    /* obtain page size */
-    page_size = val_memory_page_size();
-    /* number of bits required to index byte location inside the page */
-    page_size_log2 = log2_func(page_size);
-    /* calculate input addr size */
-    ias = 64 - tcr.tsz;
-    /* calculate bits resolved per level for all granule sizes */
-    bits_per_level = page_size_log2 - 3;
-    /* calculate max num of translation levels possible */
-    num_pgt_levels = (ias - page_size_log2 + bits_per_level - 1)/bits_per_level;
-    /* start translation from lowest level */
-    this_level = PGT_LEVEL_MAX - num_pgt_levels;
-    /* bits to translate after first translation */
-    bits_remaining = (num_pgt_levels - 1) * bits_per_level + page_size_log2;
-    /* bits translated at current level */
-    bits_at_this_level = ias - bits_remaining;
-    /* address to first translation table comes from TTBR0 register */
-    tt_base_phys = ttbr & AARCH64_TTBR_ADDR_MASK;
-
-    while (this_level < PGT_LEVEL_MAX) {
-        /* translation starts from most siginificant bits of VA */
-        index = (addr >> bits_remaining) & ((0x1u << bits_at_this_level) - 1);
-        tt_base_virt = (uint64_t *)val_memory_phys_to_virt(tt_base_phys);
-        /* index the translation table and read the entry */
-        ttable_entry = tt_base_virt[index];
-
-        val_print(TRACE, "\n   Translation table level         = %d", this_level);
-        val_print(TRACE, "\n   Table base address              = 0x%llx",
-                  (uint64_t)tt_base_virt);
-        val_print(TRACE, "\n   Table entry index               = %d", index);
-        val_print(TRACE, "\n   Table entry                     = 0x%llx",
-                  ttable_entry);
-        val_print(TRACE, "\n   VA bits remaining to be resolve = %d", bits_remaining);
-
-        /* check whether the table entry is invalid */
-        if (IS_PGT_ENTRY_INVALID(ttable_entry)) {
-            val_print(DEBUG, "\n   VA not mapped in translation table");
-            return 1;
-        }
+  /* number of bits required to index byte location inside the page */
+  geom->page_size_log2 = log2_func(val_memory_page_size());
+  /* calculate input addr size */
+  geom->ias = 64 - tcr.tsz;
+  /* calculate bits resolved per level for all granule sizes */
+  geom->bits_per_level = geom->page_size_log2 - 3;
+  /* calculate max num of translation levels possible */
+  num_pgt_levels = (geom->ias - geom->page_size_log2 + geom->bits_per_level - 1) /
+                   geom->bits_per_level;
+  /* start translation from lowest level */
+  geom->start_level = PGT_LEVEL_MAX - num_pgt_levels;
+  /* bits to translate after first translation */
+  geom->start_bits_remaining = (num_pgt_levels - 1) * geom->bits_per_level +
+                               geom->page_size_log2;
+  /* bits translated at current level */
+  geom->start_bits_at_level = geom->ias - geom->start_bits_remaining;
+  /* address to first translation table comes from TTBR0 register */
+  geom->tt_base_phys = geom->ttbr & AARCH64_TTBR_ADDR_MASK;
 
-        /* As per Arm ARM, entry of type "table descriptor" is only
-           valid at translation level 0 */
-        if (this_level == 0 && !IS_PGT_ENTRY_TABLE(ttable_entry)) {
-            val_print(DEBUG,
-                      "\n   VA not mapped correctly in translation table");
-            return 1;
-        }
+  return 0;
+}
 
-        if (this_level == 3) {
-            /* at level 3 table entry should be of type "page descriptor" with
-               ttable_entry[1:0] bits = b11 */
-            if (!IS_PGT_ENTRY_PAGE(ttable_entry)) {
-                val_print(DEBUG,
-                          "\n   VA not mapped correctly in translation table");
-                return 1;
-            }
-            else {
-                val_print(DEBUG, "\n   VA translation successful");
-                return 0;
-            }
-        }
+/**
+  @brief   Walk the TTBR0 tables for one address.
 
-        /* check whether table walk hit a block descriptor entry
-           Note : level 0 table entry can't describe a page or a block
-                  level 3 can only have entry of type page descriptor
-                  (Refer Arm ARM for more info) */
-        if (IS_PGT_ENTRY_BLOCK(ttable_entry) && this_level != 0) {
-            val_print(DEBUG, "\n   VA translation successful");
-            return 0;
-        }
+  @param   geom - walk parameters from mmu_walk_geometry.
+  @param   addr - address to be checked.
+  @param   span - bytes from addr to the end of the region described by the
+                  descriptor that ended the walk, mapped or not. 0 on error.
 
-        /* point to next translation table if table walk still not hit
-           a page or a block descriptor entry */
-        tt_base_phys = ttable_entry & (((0x1ull << (ias - page_size_log2)) - 1) << page_size_log2);
+  @return  0 - if mmu entry is present, 1 otherwise.
+**/
+static uint32_t
+mmu_walk(const mmu_walk_geom_t *geom, uint64_t addr, uint64_t *span)
+{
+  uint64_t ttable_entry, tt_base_phys, *tt_base_virt;
+  uint64_t *parent_entry = NULL;
+  uint32_t index, this_level, bits_remaining, bits_at_this_level;
+
+  *span = 0;
+
+  this_level = geom->start_level;
+  bits_remaining = geom->start_bits_remaining;
+  bits_at_this_level = geom->start_bits_at_level;
+  tt_base_phys = geom->tt_base_phys;
+
+  /* Resume from the cached table if it still covers addr */
+  if (mmu_walk_cache.valid && (mmu_walk_cache.ttbr == geom->ttbr) &&
+      ((addr & ~mmu_walk_cache.va_mask) == mmu_walk_cache.va_base) &&
+      (*mmu_walk_cache.parent_entry == mmu_walk_cache.parent_value)) {
+      this_level = mmu_walk_cache.level;
+      bits_remaining = mmu_walk_cache.bits_remaining;
+      bits_at_this_level = mmu_walk_cache.bits_at_this_level;
+      tt_base_phys = mmu_walk_cache.tt_base_phys;
+  }
 
-        /* update level and remaining VA bits to resolve */
-        ++this_level;
-        bits_remaining -= bits_at_this_level;
-        bits_at_this_level = bits_per_level;
-    }
-    /* execution should don't reach here */
-    return 1;
+  while (this_level < PGT_LEVEL_MAX) {
+      /* translation starts from most siginificant bits of VA */
+      index = (addr >> bits_remaining) & ((0x1u << bits_at_this_level) - 1);
+      tt_base_virt = (uint64_t *)val_memory_phys_to_virt(tt_base_phys);
+      /* index the translation table and read the entry */
+      ttable_entry = tt_base_virt[index];
+
+      val_print(TRACE, "\n   Translation table level         = %d", this_level);
+      val_print(TRACE, "\n   Table base address              = 0x%llx",
+                (uint64_t)tt_base_virt);
+      val_print(TRACE, "\n   Table entry index               = %d", index);
+      val_print(TRACE, "\n   Table entry                     = 0x%llx",
+                ttable_entry);
+      val_print(TRACE, "\n   VA bits remaining to be resolve = %d", bits_remaining);
+
+      /* Remember the table reached through a table descriptor */
+      if (parent_entry != NULL) {
+          mmu_walk_cache.ttbr = geom->ttbr;
+          mmu_walk_cache.parent_entry = parent_entry;
+          mmu_walk_cache.parent_value = *parent_entry;
+          mmu_walk_cache.va_mask = (0x1ull << (bits_remaining + bits_at_this_level)) - 1;
+          mmu_walk_cache.va_base = addr & ~mmu_walk_cache.va_mask;
+          mmu_walk_cache.tt_base_phys = tt_base_phys;
+          mmu_walk_cache.level = this_level;
+          mmu_walk_cache.bits_remaining = bits_remaining;
+          mmu_walk_cache.bits_at_this_level = bits_at_this_level;
+          mmu_walk_cache.valid = 1;
+      }
+
+      /* region covered by this entry, from addr to its end */
+      *span = (0x1ull << bits_remaining) - (addr & ((0x1ull << bits_remaining) - 1));
+
+      /* check whether the table entry is invalid */
+      if (IS_PGT_ENTRY_INVALID(ttable_entry)) {
+          val_print(DEBUG, "\n   VA not mapped in translation table");
+          return 1;
+      }
+
+      /* As per Arm ARM, entry of type "table descriptor" is only
+         valid at translation level 0 */
+      if (this_level == 0 && !IS_PGT_ENTRY_TABLE(ttable_entry)) {
+          val_print(DEBUG,
+                    "\n   VA not mapped correctly in translation table");
+          return 1;
+      }
+
+      if (this_level == 3) {
+          /* at level 3 table entry should be of type "page descriptor" with
+             ttable_entry[1:0] bits = b11 */
+          if (!IS_PGT_ENTRY_PAGE(ttable_entry)) {
+              val_print(DEBUG,
+                        "\n   VA not mapped correctly in translation table");
+              return 1;
+          }
+          else {
+              val_print(DEBUG, "\n   VA translation successful");
+              return 0;
+          }
+      }
+
+      /* check whether table walk hit a block descriptor entry
+         Note : level 0 table entry can't describe a page or a block
+                level 3 can only have entry of type page descriptor
+                (Refer Arm ARM for more info) */
+      if (IS_PGT_ENTRY_BLOCK(ttable_entry) && this_level != 0) {
+          val_print(DEBUG, "\n   VA translation successful");
+          return 0;
+      }
+
+      /* point to next translation table if table walk still not hit
+         a page or a block descriptor entry */
+      tt_base_phys = ttable_entry & (((0x1ull << (geom->ias - geom->page_size_log2)) - 1)
+                                     << geom->page_size_log2);
+      parent_entry = &tt_base_virt[index];
+
+      /* update level and remaining VA bits to resolve */
+      ++this_level;
+      bits_remaining -= bits_at_this_level;
+      bits_at_this_level = geom->bits_per_level;
+  }
+  /* execution should don't reach here */
+  *span = 0;
+  return 1;
+}
+
+/**
+  @brief   This API will check whether inputted base address is already
+           mapped in the translation table or not.
+
+  @param   addr - address to be checked.
+
+  @return  0 - if mmu entry is present, 1 otherwise.
+**/
+uint32_t
+val_mmu_check_for_entry(uint64_t addr)
+{
+  mmu_walk_geom_t geom;
+  uint64_t span;
+
+  if (mmu_walk_geometry(&geom))
+      return 1;
+
+  return mmu_walk(&geom, addr, &span);
+}
+
+/**
+  @brief   This API will check whether every address of a region is already
+           mapped in the translation table. Each block or page descriptor is
+           looked up once, so the cost grows with the number of descriptors
+           covering the region rather than with its size in pages. The check
+           stops at the first unmapped address.
+
+  @param   base_addr - start of the region.
+  @param   size      - size of the region in bytes.
+
+  @return  0 - if the whole region is mapped, 1 otherwise.
+**/
+uint32_t
+val_mmu_check_for_range(uint64_t base_addr, uint64_t size)
+{
+  mmu_walk_geom_t geom;
+  uint64_t addr = base_addr;
+  uint64_t end = base_addr + size;
+  uint64_t span;
+
+  if (size == 0)
+      return 0;
+
+  if (mmu_walk_geometry(&geom))
+      return 1;
+
+  while (1) {
+      if (mmu_walk(&geom, addr, &span) || (span == 0))
+          return 1;
+
+      /* region fully covered, or the walk reached the top of the VA space */
+      if ((span >= end - addr) || (addr + span < addr))
+          return 0;
+
+      addr += span;
+  }
+}
+
+/**
+  @brief   Drop the table remembered by the last walk. Called by every path
+           that writes translation tables, since a split or replaced table
+           is not always visible through the descriptor that was cached.
+
+  @param   None
+
+  @return  None
+**/
+void
+val_mmu_walk_cache_invalidate(void)
+{
+  mmu_walk_cache.valid = 0;
 }
 
 /**
@@ -215,8 +368,9 @@ val_mmu_add_entry(uint64_t base_addr, uint64_t size, uint64_t attr)
 uint32_t val_mmu_update_entry(uint64_t address, uint32_t size, uint64_t attr)
 {
 
-  /* If entry is already present return success */
-  if (!val_mmu_check_for_entry(address)) {
+  /* If the whole region is already mapped return success. A region mapped
+     only in part is mapped again in full, which is safe for Device memory. */
+  if (!val_mmu_check_for_range(address, size)) {
       val_print(DEBUG, "\n   Address is already mapped\n");
       return 0;
   }
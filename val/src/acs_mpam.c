@@ -24,6 +24,7 @@
 #include "acs_memory.h"
 #include "acs_mpam_reg.h"
 #include "acs_gic_its.h"
+#include "val_sysreg.h"
 
 static MPAM_INFO_TABLE *g_mpam_info_table;
 static SRAT_INFO_TABLE *g_srat_info_table;
@@ -898,6 +899,117 @@ val_mpam_memory_mbwumon_read_count(uint32_t msc_index)
     return(count);
 }
 
+/**
+  @brief   Poll state for waiting on a CSU or MBWU monitor to settle.
+**/
+typedef struct {
+    uint32_t msc_index;
+    uint32_t is_mbwu;
+    uint32_t stable_reads;
+    uint64_t value;
+    uint64_t start;
+    uint64_t nrdy_ticks;
+} MPAM_MON_SETTLE_t;
+
+/**
+  @brief   val_wait_until condition: the MSC NRDY window has elapsed, the
+           monitor is ready and its value has not changed for
+           MPAM_MON_SETTLE_READS consecutive polls. Records the last value
+           read in the poll state.
+
+  @param   arg  - MPAM_MON_SETTLE_t poll state.
+  @return  1 if the value has settled, else 0.
+**/
+static uint32_t
+mpam_mon_settled(void *arg)
+{
+    MPAM_MON_SETTLE_t *s = (MPAM_MON_SETTLE_t *)arg;
+    uint32_t csu;
+    uint64_t value;
+
+    if (s->is_mbwu) {
+        value = val_mpam_memory_mbwumon_read_count(s->msc_index);
+        if (value == (uint64_t)MPAM_MON_NOT_READY) {
+            s->stable_reads = 0;
+            return 0;
+        }
+    } else {
+        csu = val_mpam_mmr_read(s->msc_index, REG_MSMON_CSU);
+        if (BITFIELD_READ(MSMON_CSU_NRDY, csu)) {
+            s->stable_reads = 0;
+            return 0;
+        }
+        value = BITFIELD_READ(MSMON_CSU_VALUE, csu);
+    }
+
+    if (s->stable_reads && (value == s->value))
+        s->stable_reads++;
+    else
+        s->stable_reads = 1;
+
+    s->value = value;
+
+    /* The monitor may not reflect the traffic until MAX_NRDY_USEC has passed */
+    if ((syscounter_read() - s->start) < s->nrdy_ticks)
+        return 0;
+
+    return (s->stable_reads >= MPAM_MON_SETTLE_READS);
+}
+
+/**
+  @brief   Poll a monitor until it settles or the deadline expires. The
+           deadline is never shorter than the MSC NRDY window.
+
+  @param   s          - MPAM_MON_SETTLE_t poll state, msc_index, is_mbwu and
+                        value filled in by the caller.
+  @param   timeout_us - Deadline in microseconds.
+  @return  1 if the value settled, 0 if the deadline expired.
+**/
+static uint32_t
+mpam_mon_wait(MPAM_MON_SETTLE_t *s, uint32_t timeout_us)
+{
+    uint64_t nrdy_us = val_mpam_get_info(MPAM_MSC_NRDY, s->msc_index, 0);
+
+    if (nrdy_us > 0xFFFFFFFF)
+        nrdy_us = 0xFFFFFFFF;
+    if (timeout_us < nrdy_us)
+        timeout_us = (uint32_t)nrdy_us;
+
+    s->stable_reads = 0;
+    s->nrdy_ticks = val_get_timeout_to_ticks((uint32_t)nrdy_us);
+    s->start = syscounter_read();
+
+    return val_wait_until(mpam_mon_settled, s, timeout_us);
+}
+
+/**
+  @brief   This API waits for the MBWU monitor count to settle after a
+           memory transaction and returns it. It waits at least the MSC
+           MAX_NRDY_USEC, then returns as soon as the monitor is ready and
+           the count has stopped changing, rather than after a fixed worst
+           case delay.
+           Prerequisite - val_mpam_memory_configure_mbwumon.
+
+  @param   msc_index  - MPAM feature page index for this MSC.
+  @param   timeout_us - Deadline in microseconds.
+  @return  Settled count, or the last count read if the deadline expired
+           (MPAM_MON_NOT_READY if the monitor never became ready).
+**/
+uint64_t
+val_mpam_wait_mbwumon(uint32_t msc_index, uint32_t timeout_us)
+{
+    MPAM_MON_SETTLE_t s = {0};
+
+    s.msc_index = msc_index;
+    s.is_mbwu = 1;
+    s.value = MPAM_MON_NOT_READY;
+
+    if (!mpam_mon_wait(&s, timeout_us))
+        val_print(DEBUG, "\n       MBWU monitor not settled for MSC %d", msc_index);
+
+    return s.value;
+}
+
 /**
   @brief   This API resets the MBWU montior counter value.
            Prerequisite - val_mpam_memory_configure_mbwumon,
@@ -1683,6 +1795,32 @@ val_mpam_read_csumon(uint32_t msc_index)
     return 0;
 }
 
+/**
+  @brief   This API waits for the CSU monitor value to settle after a
+           memory transaction and returns it. It waits at least the MSC
+           MAX_NRDY_USEC, then returns as soon as the monitor is ready and
+           the value has stopped changing, rather than after a fixed worst
+           case delay.
+           Prerequisite - val_mpam_configure_csu_mon.
+
+  @param   msc_index  - MPAM feature page index for this MSC.
+  @param   timeout_us - Deadline in microseconds.
+  @return  Settled value, or the last value read if the deadline expired
+           (0 if the monitor never became ready, as val_mpam_read_csumon).
+**/
+uint32_t
+val_mpam_wait_csumon(uint32_t msc_index, uint32_t timeout_us)
+{
+    MPAM_MON_SETTLE_t s = {0};
+
+    s.msc_index = msc_index;
+
+    if (!mpam_mon_wait(&s, timeout_us))
+        val_print(DEBUG, "\n       CSU monitor not settled for MSC %d", msc_index);
+
+    return (uint32_t)s.value;
+}
+
 /**
   @brief   This API reads 32bit MPAM memory mapped register either
            via MMIO or PCC interface.
@@ -1741,10 +1879,13 @@ val_mpam_mmr_read64(uint32_t msc_index, uint32_t reg_offset)
       MPAM_PRINT_REG("Read", reg_offset, value);
       return value;
   } else if (intrf_type == MPAM_INTERFACE_TYPE_PCC) {
-      /* PCC supports only supports 32 bit read at a time, hence reading twice
-         and concating */
-      value = ((uint64_t)val_mpam_pcc_read(msc_index, reg_offset + 4) << 32)
-                                | val_mpam_pcc_read(msc_index, reg_offset);
+      /* PCC supports only 32 bit reads, hence read both halves in one
+         batch, high word first as before, and concatenate */
+      uint32_t offsets[2] = {reg_offset + 4, reg_offset};
+      uint32_t words[2];
+
+      val_mpam_pcc_read_batch(msc_index, offsets, words, 2);
+      value = ((uint64_t)words[0] << 32) | words[1];
       MPAM_PRINT_REG("Read", reg_offset, value);
       return value;
   } else {
@@ -1809,8 +1950,10 @@ val_mpam_mmr_write64(uint32_t msc_index, uint32_t reg_offset, uint64_t data)
       val_mmio_write64(base_addr + reg_offset, data);
       MPAM_PRINT_REG("Write", reg_offset, data);
   } else if (intrf_type == MPAM_INTERFACE_TYPE_PCC) {
-      val_mpam_pcc_write(msc_index, reg_offset, (uint32_t)(data & 0xFFFFFFFF));
-      val_mpam_pcc_write(msc_index, reg_offset + 4, (uint32_t)(data >> 32));
+      uint32_t offsets[2] = {reg_offset, reg_offset + 4};
+      uint32_t words[2] = {(uint32_t)(data & 0xFFFFFFFF), (uint32_t)(data >> 32)};
+
+      val_mpam_pcc_write_batch(msc_index, offsets, words, 2);
       MPAM_PRINT_REG("Write", reg_offset, data);
   } else {
     val_print(ERROR,
@@ -1820,21 +1963,29 @@ val_mpam_mmr_write64(uint32_t msc_index, uint32_t reg_offset, uint64_t data)
 }
 
 /**
-  @brief   This API constructs header and parameter for the
-           MPAM_MSC_READ PCC command and calls doorbell protocol.
+  @brief   This API reads a batch of MSC registers over PCC. The message
+           header, subspace and MSC identifier are set up once and the
+           MPAM_MSC_READ commands are issued back to back, each completing
+           on the PCC command complete bit.
 
   @param   msc_index  - MPAM feature page index for this MSC.
-  @param   reg_offset - Register offset address.
+  @param   reg_offset - Array of count register offsets.
+  @param   value      - Array of count values read. A register that could
+                        not be read returns MPAM_PCC_SAFE_RETURN.
+  @param   count      - Number of registers.
 
-  @return  None
+  @return  ACS_STATUS_PASS if every read succeeded, else ACS_STATUS_FAIL.
 **/
 uint32_t
-val_mpam_pcc_read(uint32_t msc_index, uint32_t reg_offset)
+val_mpam_pcc_read_batch(uint32_t msc_index, const uint32_t *reg_offset, uint32_t *value,
+                        uint32_t count)
 {
   SCMI_PROTOCOL_MESSAGE_HEADER header;
   PCC_MPAM_MSC_READ_CMD_PARA parameter;
   PCC_MPAM_MSC_READ_RESP_PARA *response;
   uint32_t subspace_id;
+  uint32_t status = ACS_STATUS_PASS;
+  uint32_t i;
 
   /* if MSC interface type is PCC (0x0A), the Base address field
      captures index to PCCT ACPI structure */
@@ -1851,44 +2002,57 @@ val_mpam_pcc_read(uint32_t msc_index, uint32_t reg_offset)
   /* construct parameter payload */
   parameter.msc_id = val_mpam_get_info(MPAM_MSC_ID, msc_index, 0);
   parameter.flags = 0;
-  parameter.offset = reg_offset;
 
-  response = (PCC_MPAM_MSC_READ_RESP_PARA *) val_pcc_cmd_response(
-              (uint32_t)subspace_id, *(uint32_t *)&header, (void *)&parameter, sizeof(parameter));
+  for (i = 0; i < count; i++) {
+      parameter.offset = reg_offset[i];
 
-  if (response == NULL || response->status != MPAM_PCC_CMD_SUCCESS) {
-      val_print(ERROR,
-                "\n    Failed to read MPAM register with offset (0x%x) via PCC", reg_offset);
-      val_print(ERROR, " for MSC index = 0x%x", msc_index);
-      if (response != NULL) {
-          val_print(ERROR, "\n    PCC command response code = 0x%x", response->status);
+      response = (PCC_MPAM_MSC_READ_RESP_PARA *) val_pcc_cmd_response(
+                  subspace_id, *(uint32_t *)&header, (void *)&parameter, sizeof(parameter));
+
+      if (response == NULL || response->status != MPAM_PCC_CMD_SUCCESS) {
+          val_print(ERROR,
+                    "\n    Failed to read MPAM register with offset (0x%x) via PCC",
+                    reg_offset[i]);
+          val_print(ERROR, " for MSC index = 0x%x", msc_index);
+          if (response != NULL) {
+              val_print(ERROR, "\n    PCC command response code = 0x%x", response->status);
+          }
+          value[i] = MPAM_PCC_SAFE_RETURN;
+          status = ACS_STATUS_FAIL;
+      } else {
+          value[i] = response->val;
       }
-      return MPAM_PCC_SAFE_RETURN;
-  } else {
-      return response->val;
   }
+
+  return status;
 }
 
 /**
-  @brief   This API constructs header and parameter for the
-           MPAM_MSC_WRITE PCC command and calls doorbell protocol.
+  @brief   This API writes a batch of MSC registers over PCC, in array order.
+           The message header, subspace and MSC identifier are set up once
+           and the MPAM_MSC_WRITE commands are issued back to back.
 
   @param   msc_index  - MPAM feature page index for this MSC.
-  @param   reg_offset - Register offset address.
+  @param   reg_offset - Array of count register offsets.
+  @param   data       - Array of count values to write.
+  @param   count      - Number of registers.
 
-  @return  None
+  @return  ACS_STATUS_PASS if every write succeeded, else ACS_STATUS_FAIL.
 **/
-void
-val_mpam_pcc_write(uint32_t msc_index, uint32_t reg_offset, uint32_t data)
+uint32_t
+val_mpam_pcc_write_batch(uint32_t msc_index, const uint32_t *reg_offset, const uint32_t *data,
+                         uint32_t count)
 {
   SCMI_PROTOCOL_MESSAGE_HEADER header;
   PCC_MPAM_MSC_WRITE_CMD_PARA parameter;
   PCC_MPAM_MSC_WRITE_RESP_PARA *response;
   uint32_t subspace_id;
+  uint32_t status = ACS_STATUS_PASS;
+  uint32_t i;
 
   /* if MSC interface type is PCC (0x0A), the Base address field
      captures index to PCCT ACPI structure */
-  subspace_id = val_mpam_get_info(MPAM_MSC_BASE_ADDR, msc_index, 0);
+  subspace_id = (uint32_t)val_mpam_get_info(MPAM_MSC_BASE_ADDR, msc_index, 0);
 
   /* construct the message header */
   header.reserved = 0;
@@ -1901,22 +2065,60 @@ val_mpam_pcc_write(uint32_t msc_index, uint32_t reg_offset, uint32_t data)
   /* construct parameter payload */
   parameter.msc_id = val_mpam_get_info(MPAM_MSC_ID, msc_index, 0);
   parameter.flags = 0;
-  parameter.val = data;
-  parameter.offset = reg_offset;
 
-  response = (PCC_MPAM_MSC_WRITE_RESP_PARA *) val_pcc_cmd_response(
-              (uint32_t)subspace_id, *(uint32_t *)&header, (void *)&parameter, sizeof(parameter));
+  for (i = 0; i < count; i++) {
+      parameter.val = data[i];
+      parameter.offset = reg_offset[i];
 
-  if (response == NULL || response->status != MPAM_PCC_CMD_SUCCESS) {
-      val_print(ERROR,
-                "\n    Failed to read MPAM register with offset (0x%x) via PCC", reg_offset);
-      val_print(ERROR, " for MSC index = 0x%x", msc_index);
-      if (response != NULL) {
-          val_print(ERROR, "\n    PCC command response code = 0x%x", response->status);
+      response = (PCC_MPAM_MSC_WRITE_RESP_PARA *) val_pcc_cmd_response(
+                  subspace_id, *(uint32_t *)&header, (void *)&parameter, sizeof(parameter));
+
+      if (response == NULL || response->status != MPAM_PCC_CMD_SUCCESS) {
+          val_print(ERROR,
+                    "\n    Failed to write MPAM register with offset (0x%x) via PCC",
+                    reg_offset[i]);
+          val_print(ERROR, " for MSC index = 0x%x", msc_index);
+          if (response != NULL) {
+              val_print(ERROR, "\n    PCC command response code = 0x%x", response->status);
+          }
+          status = ACS_STATUS_FAIL;
       }
-      return;
   }
-  return;
+
+  return status;
+}
+
+/**
+  @brief   This API constructs header and parameter for the
+           MPAM_MSC_READ PCC command and calls doorbell protocol.
+
+  @param   msc_index  - MPAM feature page index for this MSC.
+  @param   reg_offset - Register offset address.
+
+  @return  Value read, or MPAM_PCC_SAFE_RETURN on failure.
+**/
+uint32_t
+val_mpam_pcc_read(uint32_t msc_index, uint32_t reg_offset)
+{
+  uint32_t value;
+
+  val_mpam_pcc_read_batch(msc_index, &reg_offset, &value, 1);
+  return value;
+}
+
+/**
+  @brief   This API constructs header and parameter for the
+           MPAM_MSC_WRITE PCC command and calls doorbell protocol.
+
+  @param   msc_index  - MPAM feature page index for this MSC.
+  @param   reg_offset - Register offset address.
+
+  @return  None
+**/
+void
+val_mpam_pcc_write(uint32_t msc_index, uint32_t reg_offset, uint32_t data)
+{
+  val_mpam_pcc_write_batch(msc_index, &reg_offset, &data, 1);
 }
 
 /**
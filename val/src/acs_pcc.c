@@ -20,9 +20,13 @@
 #include "acs_val.h"
 #include "acs_common.h"
 #include "val_interface.h"
+#include "val_sysreg.h"
 
 static PCC_INFO_TABLE *g_pcc_info_table;
 
+/* System counter value when the last PCC command completed */
+static uint64_t g_pcc_last_complete_ticks;
+
 /* PCCT related APIs */
 
 /**
@@ -71,9 +75,53 @@ val_pcc_get_ss_info_idx(uint32_t subspace_id)
   return RETURN_FAILURE;
 }
 
+/**
+  @brief  val_wait_until condition: the subspace command complete bit is set,
+          i.e. the shared memory region is owned by OSPM.
+
+  @param  arg  - PCC_SUBSPACE_TYPE_3 of the subspace.
+
+  @return 1 if command complete is set, else 0.
+**/
+static uint32_t
+pcc_cmd_complete_set(void *arg)
+{
+  PCC_SUBSPACE_TYPE_3 *ss = (PCC_SUBSPACE_TYPE_3 *)arg;
+
+  return (val_mmio_read(ss->cmd_complete_chk_reg.addr) & ss->cmd_complete_chk_mask) != 0;
+}
+
+/**
+  @brief  Honour the subspace minimum request turnaround time, which is the
+          minimum delay between the end of one command and the start of the
+          next. Only the part not already elapsed is waited for.
+
+  @param  ss  - PCC_SUBSPACE_TYPE_3 of the subspace.
+
+  @return None
+**/
+static void
+pcc_wait_turnaround(PCC_SUBSPACE_TYPE_3 *ss)
+{
+  uint64_t min_ticks;
+
+  if (g_pcc_last_complete_ticks == 0 || ss->min_req_turnaround_usec == 0)
+      return;
+
+  min_ticks = val_get_timeout_to_ticks(ss->min_req_turnaround_usec);
+  while ((syscounter_read() - g_pcc_last_complete_ticks) < min_ticks)
+      ;
+}
+
 /**
   @brief  This API implements ACPI Doorbell protocol.
 
+          Completion is detected from the command complete bit, polled with
+          val_wait_until. The PE waits in WFE between polls, so a platform
+          completion interrupt, if one is routed, ends the wait early.
+          PCC_CMD_TIMEOUT_US is only the deadline for a platform that never
+          completes.
+
   @param  subspace_idx  - Subspace id, used to index PCCT array.
   @param  command       - PCC command header
   @param  data          - pointer to data to be written to communication
@@ -87,8 +135,6 @@ void
 {
 
   uint32_t pcc_idx;
-  uint32_t loop_cnt;
-  uint32_t cmd_complete;
   uint64_t shared_mem_addr;
   uint64_t cmd_complete_upd_reg;
   uint64_t doorbell_val;
@@ -109,31 +155,22 @@ void
   /* Note : For information on Doorbell Protocol refer ACPI 6.5 specification; section 14.5 */
 
   /* ensuring command complete check is set, indicating shared memory
-     exclusively owned by OSPM */
-  loop_cnt = 3;
-  do {
-      /* wait for minimum request turnaround time * 3 to provide time for platform */
-      val_time_delay_ms(ptr_to_pcc_ss_type_3->min_req_turnaround_usec);
-      /* read command complete check register */
-      cmd_complete = val_mmio_read(ptr_to_pcc_ss_type_3->cmd_complete_chk_reg.addr) &
-                                ptr_to_pcc_ss_type_3->cmd_complete_chk_mask;
-      loop_cnt--;
-  } while (cmd_complete == 0 || loop_cnt != 0);
-
-  /* if platform not setting complete, return with failure */
-  if (loop_cnt == 0) {
+     exclusively owned by OSPM. It normally still is from the previous command. */
+  if (!val_wait_until(pcc_cmd_complete_set, ptr_to_pcc_ss_type_3, PCC_CMD_TIMEOUT_US)) {
       val_print(ERROR,
                 "\n    Platform fails to set command complete reg for PCC subspace id : 0x%x",
                 subspace_id);
       return NULL;
   }
 
+  pcc_wait_turnaround(ptr_to_pcc_ss_type_3);
+
   /* write command and parameters to PCC shared memory region */
   shared_mem_addr = ptr_to_pcc_ss_type_3->base_addr;
   /* write command */
   val_mmio_write(shared_mem_addr + PCC_TY3_CMD_OFFSET, command);
   /* write parameters */
-  val_memcpy((void *)(shared_mem_addr + PCC_TY3_COMM_SPACE), data, data_size);
+  val_memcpy_io((void *)(shared_mem_addr + PCC_TY3_COMM_SPACE), data, data_size);
 
   /* clear command complete indicating platform to process the command
      using command complete update register */
@@ -151,25 +188,16 @@ void
                     | ptr_to_pcc_ss_type_3->doorbell_write;
   val_mmio_write(ptr_to_pcc_ss_type_3->doorbell_reg.addr, doorbell_val);
 
-  /* wait for minimum request turnaround time and poll on the command complete bit for set */
-  loop_cnt = 3;
-  do {
-      /* wait for minimum request turnaround time * 3 to provide time for platform */
-      val_time_delay_ms(ptr_to_pcc_ss_type_3->min_req_turnaround_usec);
-      /* read command complete check register */
-      cmd_complete = val_mmio_read(ptr_to_pcc_ss_type_3->cmd_complete_chk_reg.addr) &
-                                ptr_to_pcc_ss_type_3->cmd_complete_chk_mask;
-      loop_cnt--;
-  } while (cmd_complete == 0 || loop_cnt != 0);
-
-  /* if platform not setting complete, return with failure */
-  if (loop_cnt == 0) {
+  /* wait for the platform to set the command complete bit */
+  if (!val_wait_until(pcc_cmd_complete_set, ptr_to_pcc_ss_type_3, PCC_CMD_TIMEOUT_US)) {
       val_print(ERROR,
           "\n    Platform fails to set command complete, post command for PCC subspace id : 0x%x",
           subspace_id);
       return NULL;
   }
 
+  g_pcc_last_complete_ticks = syscounter_read();
+
   /* process response from platform */
   /* return pointer to communication subspace with response data */
   return (void *)(shared_mem_addr + PCC_TY3_COMM_SPACE);
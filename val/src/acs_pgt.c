@@ -366,6 +366,9 @@ uint64_t val_pgt_ioremap_attr(pgt_descriptor_t pgt_desc,
     if (Status)
         return Status;
 
+    /* descriptors are rewritten in place, cached walks restart from TTBR0 */
+    val_mmu_walk_cache_invalidate();
+
     for (uint64_t a = va; a < va + size; a += page_size) {
 
         uint64_t *pte = val_find_pte(pgt_desc, a);
@@ -615,6 +618,9 @@ uint32_t val_pgt_create(memory_region_descriptor_t *mem_desc, pgt_descriptor_t *
     uint32_t num_pgt_levels, page_size_log2;
     memory_region_descriptor_t *mem_desc_iter;
 
+    /* tables may be split or replaced, cached walks restart from TTBR0 */
+    val_mmu_walk_cache_invalidate();
+
     page_size = val_memory_page_size();
     page_size_log2 = log2_page_size(page_size);
     bits_per_level = page_size_log2 - 3;
@@ -805,6 +811,9 @@ void val_pgt_destroy(pgt_descriptor_t pgt_desc)
     if (!pgt_desc.pgt_base)
         return;
 
+    /* freed table pages must not be reached through a cached walk */
+    val_mmu_walk_cache_invalidate();
+
     val_print(PGT_DEBUG_LEVEL, "\n       val_pgt_destroy: pgt_base = %llx     ", pgt_desc.pgt_base);
     page_size = val_memory_page_size();
     page_size_log2 = log2_page_size(page_size);
@@ -20,6 +20,7 @@
 #include "acs_common.h"
 #include "acs_pe.h"
 #include "acs_ras.h"
+#include "val_sysreg.h"
 
 static RAS_INFO_TABLE  *g_ras_info_table;
 static RAS2_INFO_TABLE *g_ras2_info_table;
@@ -353,6 +354,22 @@ val_ras2_get_mem_info(RAS2_MEM_INFO_e type, uint32_t index)
   return INVALID_RAS2_INFO;
 }
 
+/**
+  @brief   Return the interface info of a RAS node for register access.
+  @param   node_index  RAS Node Index
+  @return  Interface info pointer, NULL if the node index is out of range
+**/
+static RAS_INTERFACE_INFO *
+val_ras_node_intf(uint32_t node_index)
+{
+  if ((g_ras_info_table == NULL) || (node_index >= g_ras_info_table->num_nodes)) {
+      val_print(ERROR, "\n       RAS : Invalid node index(%d)", node_index);
+      return NULL;
+  }
+
+  return &g_ras_info_table->node[node_index].intf_info;
+}
+
 /**
   @brief   This API will be used to Read RAS Registers based on interface
            1. Caller       -  Test layer.
@@ -365,28 +382,29 @@ val_ras2_get_mem_info(RAS2_MEM_INFO_e type, uint32_t index)
 uint64_t
 val_ras_reg_read(uint32_t node_index, uint32_t reg, uint32_t err_rec_idx)
 {
-  uint64_t base, value = INVALID_RAS_REG_VAL;
+  uint64_t value = INVALID_RAS_REG_VAL;
   uint32_t start_rec_index, offset = 0;
-  uint64_t num_err_recs, err_rec_impl_bitmap;
+  RAS_INTERFACE_INFO *intf;
 
-  start_rec_index = g_ras_info_table->node[node_index].intf_info.start_rec_index;
+  intf = val_ras_node_intf(node_index);
+  if (intf == NULL)
+      return INVALID_RAS_REG_VAL;
+
+  start_rec_index = intf->start_rec_index;
 
   /* err_rec_idx = 0 means the first error record of the node */
   if (err_rec_idx == 0)
       err_rec_idx = start_rec_index;
 
   /* Check if err record index is valid */
-  val_ras_get_info(RAS_INFO_NUM_ERR_REC, node_index, &num_err_recs);
-  if ((err_rec_idx - start_rec_index) >= num_err_recs) {
+  if ((err_rec_idx - start_rec_index) >= intf->num_err_rec) {
       val_print(ERROR,
                 "\n       RAS_REG_READ : Invalid Input error record index(%d)\n", err_rec_idx);
       return INVALID_RAS_REG_VAL;
   }
 
   /* check if err record is implemented for given node index*/
-  val_ras_get_info(RAS_INFO_ERR_REC_IMP, node_index, &err_rec_impl_bitmap);
-
-  if ((err_rec_impl_bitmap >> err_rec_idx) & 0x1) {
+  if ((err_rec_idx < 64) && ((intf->err_rec_implement >> err_rec_idx) & 0x1)) {
       val_print(ERROR,
                 "\n       RAS_REG_READ : Error record index(%d) is unimplemented ", err_rec_idx);
       val_print(ERROR,
@@ -394,11 +412,21 @@ val_ras_reg_read(uint32_t node_index, uint32_t reg, uint32_t err_rec_idx)
       return INVALID_RAS_REG_VAL;
   }
 
-  if (g_ras_info_table->node[node_index].intf_info.intf_type == RAS_INTF_TYPE_MMIO) {
-      /* MMIO based RAS register read */
+  /* ERR<n>PFGCDN and ERR<n>PFGCTL are valid only for the first error record */
+  if (((reg == RAS_ERR_PFGCDN) || (reg == RAS_ERR_PFGCTL)) &&
+      (err_rec_idx != start_rec_index)) {
+      if (reg == RAS_ERR_PFGCDN)
+          val_print(ERROR,
+                "\n       RAS_REG_READ : ERR<%d>PFGCDN is RES0 for node index :", err_rec_idx);
+      else
+          val_print(ERROR,
+                "\n       RAS_REG_READ : ERR<%d>PFGCTL is RES0 for node index :", err_rec_idx);
+      val_print(ERROR, " %d", node_index);
+      return INVALID_RAS_REG_VAL;
+  }
 
-      /* Get the Base address for this node */
-      base = g_ras_info_table->node[node_index].intf_info.base_addr;
+  if (intf->intf_type == RAS_INTF_TYPE_MMIO) {
+      /* MMIO based RAS register read */
 
       switch (reg) {
       case RAS_ERR_FR:
@@ -418,26 +446,10 @@ val_ras_reg_read(uint32_t node_index, uint32_t reg, uint32_t err_rec_idx)
           offset = ERR_ADDR_OFFSET + (64 * err_rec_idx);
           break;
       case RAS_ERR_PFGCDN:
-          /* ERR<n>PFGCDN RAS register is valid only for first error record */
-          if (err_rec_idx == start_rec_index)
-              offset = ERR_PFGCDN_OFFSET + (64 * start_rec_index);
-          else {
-              val_print(ERROR,
-                "\n       RAS_REG_READ : ERR<%d>PFGCDN is RES0 for node index :", err_rec_idx);
-              val_print(ERROR, " %d", node_index);
-              return INVALID_RAS_REG_VAL;
-          }
+          offset = ERR_PFGCDN_OFFSET + (64 * start_rec_index);
           break;
       case RAS_ERR_PFGCTL:
-          /* ERR<n>PFGCTL RAS register is valid only for first error record */
-          if (err_rec_idx == start_rec_index)
-              offset = ERR_PFGCTL_OFFSET + (64 * start_rec_index);
-          else {
-              val_print(ERROR,
-                "\n       RAS_REG_READ : ERR<%d>PFGCTL is RES0 for node index :", err_rec_idx);
-              val_print(ERROR, " %d", node_index);
-              return INVALID_RAS_REG_VAL;
-          }
+          offset = ERR_PFGCTL_OFFSET + (64 * start_rec_index);
           break;
       case RAS_ERR_ERRDEVAFF:
           /* only valid for MMIO interface */
@@ -445,55 +457,35 @@ val_ras_reg_read(uint32_t node_index, uint32_t reg, uint32_t err_rec_idx)
       default:
           break;
       }
-      value = val_mmio_read64(base + offset);
+      value = val_mmio_read64(intf->base_addr + offset);
   } else {
       /* System register based read */
 
-      /* RAS registers reads with ERRSELR_EL1.SEL set to start error record index */
-      write_errselr_el1(start_rec_index);
-
+      /* ERR<n>STATUS and ERR<n>ADDR are unique to each error record, the rest are
+        read through the first error record. Select the record only once. */
       switch (reg) {
       case RAS_ERR_FR:
+          write_errselr_el1(start_rec_index);
           value = read_erxfr_el1();
           break;
       case RAS_ERR_CTLR:
+          write_errselr_el1(start_rec_index);
           value = read_erxctlr_el1();
           break;
       case RAS_ERR_PFGCDN:
-          /* ERR<n>PFGCDN RAS register is valid only for first error record */
-          if (err_rec_idx == start_rec_index)
-              value = read_erxpfgcdn_el1();
-          else {
-              val_print(ERROR,
-                "\n       RAS_REG_READ : ERR<%d>PFGCDN is RES0 for the node index :", err_rec_idx);
-              val_print(ERROR, " %d", node_index);
-              return INVALID_RAS_REG_VAL;
-          }
+          write_errselr_el1(start_rec_index);
+          value = read_erxpfgcdn_el1();
           break;
       case RAS_ERR_PFGCTL:
-          /* ERR<n>PFGCTL RAS register is valid only for first error record */
-          if (err_rec_idx == start_rec_index)
-              value = read_erxpfgctl_el1();
-          else {
-              val_print(ERROR,
-                "\n       RAS_REG_READ : ERR<%d>PFGCTL is RES0 for the node index :", err_rec_idx);
-              val_print(ERROR, " %d", node_index);
-              return INVALID_RAS_REG_VAL;
-          }
-          break;
-      default:
+          write_errselr_el1(start_rec_index);
+          value = read_erxpfgctl_el1();
           break;
-      }
-
-      /* RAS registers reads with ERRSELR_EL1.SEL set to current error record index
-        These registers are unique to given error record */
-      write_errselr_el1(err_rec_idx);
-
-      switch (reg) {
       case RAS_ERR_STATUS:
+          write_errselr_el1(err_rec_idx);
           value = read_erxstatus_el1();
           break;
       case RAS_ERR_ADDR:
+          write_errselr_el1(err_rec_idx);
           value = read_erxaddr_el1();
           break;
       default:
@@ -516,16 +508,17 @@ val_ras_reg_read(uint32_t node_index, uint32_t reg, uint32_t err_rec_idx)
 void
 val_ras_reg_write(uint32_t node_index, uint32_t reg, uint64_t write_data)
 {
-  uint64_t base;
   uint32_t rec_index, offset = 0;
+  RAS_INTERFACE_INFO *intf;
 
-  rec_index = g_ras_info_table->node[node_index].intf_info.start_rec_index;
+  intf = val_ras_node_intf(node_index);
+  if (intf == NULL)
+      return;
 
-  if (g_ras_info_table->node[node_index].intf_info.intf_type == RAS_INTF_TYPE_MMIO) {
-    /* MMIO Based Write */
+  rec_index = intf->start_rec_index;
 
-    /* Get the Base address for this node */
-    base = g_ras_info_table->node[node_index].intf_info.base_addr;
+  if (intf->intf_type == RAS_INTF_TYPE_MMIO) {
+    /* MMIO Based Write */
 
     switch (reg) {
     case RAS_ERR_FR:
@@ -547,7 +540,7 @@ val_ras_reg_write(uint32_t node_index, uint32_t reg, uint64_t write_data)
       break;
     }
 
-    val_mmio_write64(base + offset, write_data);
+    val_mmio_write64(intf->base_addr + offset, write_data);
   } else {
     /* System register based Write */
 
@@ -694,13 +687,94 @@ val_ras_wait_timeout(uint32_t count)
   pal_ras_wait_timeout(count);
 }
 
+typedef struct {
+  uint32_t node_index;
+  volatile uint32_t *intr_pending;
+} RAS_WAIT_ERROR_t;
+
+/**
+  @brief  val_wait_until condition for val_ras_wait_error.
+
+  @param  arg  - RAS_WAIT_ERROR_t being waited on.
+
+  @return 1 once the interrupt is taken, or, with no interrupt to wait for,
+          once any implemented error record of the node has ERR<n>STATUS.V set
+**/
+static uint32_t
+ras_err_latched(void *arg)
+{
+  RAS_WAIT_ERROR_t *wait = (RAS_WAIT_ERROR_t *)arg;
+  RAS_INTERFACE_INFO *intf;
+  uint32_t rec_index, last_rec;
+  uint64_t value;
+
+  if (wait->intr_pending != NULL)
+      return (*wait->intr_pending == 0);
+
+  intf = &g_ras_info_table->node[wait->node_index].intf_info;
+  last_rec = intf->start_rec_index + intf->num_err_rec;
+
+  for (rec_index = intf->start_rec_index; rec_index < last_rec; rec_index++) {
+      if ((rec_index < 64) && ((intf->err_rec_implement >> rec_index) & 0x1))
+          continue;
+
+      value = val_ras_reg_read(wait->node_index, RAS_ERR_STATUS, rec_index);
+      if ((value != INVALID_RAS_REG_VAL) && (value & ERR_STATUS_V_MASK))
+          return 1;
+  }
+
+  return 0;
+}
+
+/**
+  @brief  Wait for an injected error to be seen, instead of a fixed delay.
+          Returns as soon as the interrupt handler clears *intr_pending or,
+          when intr_pending is NULL, as soon as an error record of the node
+          has ERR<n>STATUS.V set. The latch latency is reported at DEBUG.
+
+  @param  node_index    - RAS Node index in the info table.
+  @param  intr_pending  - Flag cleared by the test interrupt handler, or NULL.
+  @param  timeout_us    - Deadline in microseconds.
+
+  @return 1 if the error was seen, 0 on timeout
+**/
+uint32_t
+val_ras_wait_error(uint32_t node_index, volatile uint32_t *intr_pending, uint32_t timeout_us)
+{
+  RAS_WAIT_ERROR_t wait;
+  uint64_t start, elapsed_us, freq;
+  uint32_t seen;
+
+  if ((g_ras_info_table == NULL) || (node_index >= g_ras_info_table->num_nodes)) {
+      val_print(ERROR, "\n       RAS : Invalid node index(%d)", node_index);
+      return 0;
+  }
+
+  wait.node_index = node_index;
+  wait.intr_pending = intr_pending;
+
+  start = syscounter_read();
+  seen = val_wait_until(ras_err_latched, &wait, timeout_us);
+
+  freq = val_get_counter_frequency();
+  elapsed_us = freq ? ((syscounter_read() - start) * 1000000) / freq : 0;
+
+  if (seen)
+      val_print(DEBUG, "\n       RAS node %d error seen after ", node_index);
+  else
+      val_print(DEBUG, "\n       RAS node %d error not seen within ", node_index);
+  val_print(DEBUG, "%llu us", elapsed_us);
+
+  return seen;
+}
+
 void
 ras_pfg_access_node(uint32_t node_index)
 {
   uint64_t reg_value;
 
-  /* Loop for Wait */
-  val_ras_wait_timeout(1);
+  /* Wait for the pseudo fault countdown to expire */
+  val_ras_wait_error(node_index, NULL, RAS_ERR_LATCH_TIMEOUT_US);
 
   /* Access to the Node register, Might need an imp def way here */
   reg_value = val_ras_reg_read(node_index, RAS_ERR_CTLR, 0);
@@ -773,8 +847,8 @@ uint32_t val_ras_check_err_record(uint32_t node_index, uint32_t error_type)
   uint64_t err_status;
   uint32_t err_type_mask = 0;
 
-  /* Loop for Wait */
-  val_ras_wait_timeout(1);
+  /* Wait for the error to be recorded */
+  val_ras_wait_error(node_index, NULL, RAS_ERR_LATCH_TIMEOUT_US);
 
   err_status = val_ras_reg_read(node_index, RAS_ERR_STATUS, 0);
   if (err_status == INVALID_RAS_REG_VAL) {
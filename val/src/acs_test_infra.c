@@ -25,6 +25,8 @@
 
 uint32_t g_override_skip;
 static acs_test_status_counters_t g_rule_test_stats;
+/* Counter ticks spent in test payloads, sampled by the rule profiler */
+static uint64_t g_test_payload_ticks;
 /**
   @brief  Print standardized log context prefix.
           1. Caller       - Application/VAL layers
@@ -638,10 +640,13 @@ val_run_test_payload(uint32_t test_num, uint32_t num_pe, void (*payload)(void),
 
   uint32_t my_index = val_pe_get_primary_index();
   uint32_t i;
+  uint64_t start = syscounter_read();
 
   payload();  //this is test run separately on present PE
-  if (num_pe == 1)
+  if (num_pe == 1) {
+      g_test_payload_ticks += syscounter_read() - start;
       return;
+  }
 
   //Now run the test on all other PE
   for (i = 0; i < num_pe; i++) {
@@ -650,6 +655,20 @@ val_run_test_payload(uint32_t test_num, uint32_t num_pe, void (*payload)(void),
   }
 
   val_wait_for_test_completion(test_num, num_pe, TIMEOUT_LARGE);
+  g_test_payload_ticks += syscounter_read() - start;
+}
+
+/**
+  @brief  Returns the running total of counter ticks spent in
+          val_run_test_payload, including waiting for secondary PEs.
+          1. Caller       - Rule based orchestrator
+
+  @return Accumulated counter ticks
+ **/
+uint64_t
+val_get_test_payload_ticks(void)
+{
+  return g_test_payload_ticks;
 }
 
 /**
@@ -561,3 +561,137 @@ val_get_timeout_to_ticks(uint32_t timeout_us)
 
     return ticks;
 }
+
+/**
+  @brief  Enable the generic timer event stream for the current EL so that a
+          WFE returns at least every VAL_WAIT_EVENT_PERIOD_US.
+
+  @param  freq  System counter frequency in Hz.
+
+  @return Previous value of the event stream control register, to be passed
+          to timer_event_stream_restore().
+**/
+static uint64_t
+timer_event_stream_enable(uint64_t freq)
+{
+    uint64_t ctl, new_ctl;
+    uint64_t period_ticks = (freq * VAL_WAIT_EVENT_PERIOD_US) / MICRO_SECONDS;
+    uint32_t evnti = 0;
+
+    /* An event is generated each time counter bit EVNTI toggles,
+       i.e. every 2^(EVNTI + 1) ticks */
+    while ((evnti < ARM_ARCH_TIMER_EVNTI_MAX) && ((2ULL << (evnti + 1)) <= period_ticks))
+      evnti++;
+
+    if (val_pe_reg_read(CurrentEL) == AARCH64_EL2)
+      ctl = read_cnthctl_el2();
+    else
+      ctl = read_cntkctl_el1();
+
+    new_ctl = ctl & ~(ARM_ARCH_TIMER_EVNTI_MASK | ARM_ARCH_TIMER_EVNTDIR);
+    new_ctl |= ((uint64_t)evnti << ARM_ARCH_TIMER_EVNTI_SHIFT) | ARM_ARCH_TIMER_EVNTEN;
+
+    if (val_pe_reg_read(CurrentEL) == AARCH64_EL2)
+      write_cnthctl_el2(new_ctl);
+    else
+      write_cntkctl_el1(new_ctl);
+    isb();
+
+    return ctl;
+}
+
+static void
+timer_event_stream_restore(uint64_t ctl)
+{
+    if (val_pe_reg_read(CurrentEL) == AARCH64_EL2)
+      write_cnthctl_el2(ctl);
+    else
+      write_cntkctl_el1(ctl);
+    isb();
+}
+
+/**
+  @brief  Wait until cond(arg) returns non-zero or timeout_us has elapsed on
+          the system counter. The PE sleeps in WFE between checks; it is woken
+          by the interrupt being waited for (exception return sets the event
+          register) or by the timer event stream, so the timeout is the same
+          wall time on every platform.
+           1. Caller       -  Test Suite
+           2. Prerequisite -  None
+
+  @param  cond        Condition to poll. Must be cheap and side effect free.
+  @param  arg         Argument passed to cond.
+  @param  timeout_us  Maximum time to wait in microseconds.
+
+  @return 1 if the condition became true, 0 on timeout.
+**/
+uint32_t
+val_wait_until(uint32_t (*cond)(void *arg), void *arg, uint32_t timeout_us)
+{
+    uint64_t freq = val_get_counter_frequency();
+    uint64_t timeout_ticks = val_get_timeout_to_ticks(timeout_us);
+    uint64_t start, saved_ctl;
+    uint32_t met = 0;
+
+    if (cond(arg))
+      return 1;
+
+    saved_ctl = timer_event_stream_enable(freq);
+    start = syscounter_read();
+
+    while (1) {
+      if (cond(arg)) {
+        met = 1;
+        break;
+      }
+
+      if ((syscounter_read() - start) >= timeout_ticks)
+        break;
+
+      wfe();
+    }
+
+    timer_event_stream_restore(saved_ctl);
+
+    /* The flag may have been set by an interrupt taken on the final check */
+    return met ? 1 : (cond(arg) != 0);
+}
+
+typedef struct {
+  volatile uint32_t *flag1;
+  volatile uint32_t *flag2;
+} VAL_WAIT_FLAGS_t;
+
+static uint32_t
+wait_flags_set(void *arg)
+{
+    VAL_WAIT_FLAGS_t *flags = (VAL_WAIT_FLAGS_t *)arg;
+
+    if (*flags->flag1)
+      return 1;
+
+    return ((flags->flag2 != NULL) && *flags->flag2);
+}
+
+/**
+  @brief  Wait until either flag becomes non-zero, typically set from an ISR,
+          or timeout_us has elapsed. See val_wait_until.
+           1. Caller       -  Test Suite
+           2. Prerequisite -  None
+
+  @param  flag1       Flag to wait on.
+  @param  flag2       Optional second flag (e.g. failsafe interrupt), may be NULL.
+  @param  timeout_us  Maximum time to wait in microseconds.
+
+  @return 1 if a flag was set, 0 on timeout.
+**/
+uint32_t
+val_wait_for_flags(volatile uint32_t *flag1, volatile uint32_t *flag2, uint32_t timeout_us)
+{
+    VAL_WAIT_FLAGS_t flags;
+
+    flags.flag1 = flag1;
+    flags.flag2 = flag2;
+
+    return val_wait_until(wait_flags_set, &flags, timeout_us);
+}
@@ -0,0 +1,65 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+/*
+ * GENERATED by tools/scripts/gen_alias_plan.py from val/src/rule_metadata.c.
+ * Do not edit; rerun the script after changing alias_rule_map or any alias
+ * child list. The script rejects alias cycles and chains that would not fit
+ * the rule reference path, so a build from a current plan cannot hit either
+ * at run time.
+ */
+
+#include "rule_based_execution.h"
+
+/* Number of alias_rule_map entries this plan was generated for */
+const uint32_t alias_rule_plan_count = 32;
+
+/* alias_rule_map index + 1 for each alias rule id; 0 for base rules */
+const uint8_t alias_rule_map_slot[RULE_ID_SENTINEL] = {
+    [B_WD_00]   = 1,
+    [B_PER_08]  = 2,
+    [JKZMT]     = 3,
+    [B_REP_1]   = 4,
+    [HVZJY]     = 5,
+    [IE_CFG_3]  = 6,
+    [B_IEP_1]   = 7,
+    [RI_SMU_4]  = 8,
+    [B_SMMU_21] = 9,
+    [S_L3_01]   = 10,
+    [S_L3PR_01] = 11,
+    [S_L3WD_01] = 12,
+    [S_L6PCI_1] = 13,
+    [S_L6PE_01] = 14,
+    [S_PCIe_10] = 15,
+    [S_L7PMU]   = 16,
+    [S_L8SHD_1] = 17,
+    [SYS_RAS]   = 18,
+    [LVQBC]     = 19,
+    [S_L8CXL_1] = 20,
+    [XDGKZ]     = 21,
+    [S_L5SM_04] = 22,
+    [S_L6SM_04] = 23,
+    [P_L1_01]   = 24,
+    [P_L2WD_01] = 25,
+    [P_L1MM_01] = 26,
+    [V_L1PE_01] = 27,
+    [V_L1MM_01] = 28,
+    [V_L1GI_01] = 29,
+    [V_L1SM_01] = 30,
+    [V_L1PR_01] = 31,
+    [V_L1PR_02] = 32,
+};
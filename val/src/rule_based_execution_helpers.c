@@ -17,6 +17,7 @@
 
 #include "rule_based_execution.h"
 #include "val_interface.h"
+#include "val_libc.h"
 
 extern rule_test_map_t rule_test_map[RULE_ID_SENTINEL];
 extern char *rule_id_string[RULE_ID_SENTINEL];
@@ -148,77 +149,65 @@ const RULE_ID_e *rule_reference_path_get(void)
 }
 
 /**
- * @brief In-place quicksort for rule ID arrays.
+ * @brief Compare two rule IDs as unsigned values for val_sort().
  *
- * Sorts an array of `RULE_ID_e` values in ascending order using an
- * iterative quicksort (no recursion). The implementation processes the
- * smaller partition first to keep the auxiliary stack depth bounded.
+ * Out-of-range IDs, negative ones included, compare above every valid ID.
+ */
+static int rule_id_compare(const void *a, const void *b)
+{
+    uint32_t ra = (uint32_t)*(const RULE_ID_e *)a;
+    uint32_t rb = (uint32_t)*(const RULE_ID_e *)b;
+
+    return (ra > rb) - (ra < rb);
+}
+
+/**
+ * @brief In-place counting sort for rule ID arrays.
  *
- * @param rule_list Pointer to the array of `RULE_ID_e` to sort.
- * @param list_size Number of elements in `rule_list`.
+ * Sorts an array of `RULE_ID_e` values in ascending order. Rule IDs are
+ * bounded by RULE_ID_SENTINEL, so counting occurrences per ID and rewriting
+ * the array is linear in list size and does not degrade on already sorted
+ * input (the common case for lists expanded from rule_lookup.c tables).
+ * Duplicates are preserved. IDs outside the enum range are moved to the end
+ * in their original order.
+ *
+ * The counts live in a caller-provided buffer so the function keeps no
+ * state between calls. Without one, the list is heap sorted instead.
+ *
+ * @param rule_list  Pointer to the array of `RULE_ID_e` to sort.
+ * @param list_size  Number of elements in `rule_list`.
+ * @param rule_count Scratch buffer of RULE_ID_SENTINEL entries, or NULL.
  */
-void quick_sort_rule_list(RULE_ID_e *rule_list, uint32_t list_size)
+void sort_rule_list(RULE_ID_e *rule_list, uint32_t list_size, uint32_t *rule_count)
 {
+    uint32_t i;
+    uint32_t rid;
+    uint32_t out = 0;
+    uint32_t invalid = 0;
+
     if (!rule_list || list_size < 2) return;          /* quick exit */
 
-    /* Small fixed size stack (32 pairs handle any 32bit length) */
-    int lo_stack[32];
-    int hi_stack[32];
-    int top = 0;
-
-    lo_stack[0] = 0;
-    hi_stack[0] = (int)list_size - 1;
-
-    while (top >= 0)
-    {
-        int lo = lo_stack[top];
-        int hi = hi_stack[top];
-        --top;
-
-        while (lo < hi)
-        {
-            /* Partition step */
-            RULE_ID_e pivot = rule_list[hi];
-            int i = lo - 1;
-
-            for (int j = lo; j < hi; ++j)
-            {
-                if (rule_list[j] <= pivot)
-                {
-                    ++i;
-                    RULE_ID_e tmp = rule_list[i];
-                    rule_list[i] = rule_list[j];
-                    rule_list[j] = tmp;
-                }
-            }
+    if (rule_count == NULL) {
+        val_sort(rule_list, list_size, sizeof(RULE_ID_e), rule_id_compare);
+        return;
+    }
 
-            ++i;                                    /* pivot's final spot */
-            RULE_ID_e tmp = rule_list[i];
-            rule_list[i] = rule_list[hi];
-            rule_list[hi] = tmp;
-
-            /* Handle smaller side first to control stack depth */
-            if (i - lo < hi - i)
-            {
-                /* Push right half */
-                if (i + 1 < hi) {
-                    ++top;
-                    lo_stack[top] = i + 1;
-                    hi_stack[top] = hi;
-                }
-                hi = i - 1;                          /* loop on left half */
-            }
-            else
-            {
-                /* Push left half */
-                if (lo < i - 1) {
-                    ++top;
-                    lo_stack[top] = lo;
-                    hi_stack[top] = i - 1;
-                }
-                lo = i + 1;                          /* loop on right half */
-            }
-        }
+    val_memory_set(rule_count, RULE_ID_SENTINEL * sizeof(uint32_t), 0);
+
+    for (i = 0; i < list_size; i++) {
+        if ((uint32_t)rule_list[i] < RULE_ID_SENTINEL)
+            rule_count[rule_list[i]]++;
+        else
+            rule_list[invalid++] = rule_list[i];    /* compact out-of-range ids */
+    }
+
+    /* Shift out-of-range ids to the tail, keeping their relative order */
+    for (i = invalid; i > 0; i--)
+        rule_list[list_size - invalid + i - 1] = rule_list[i - 1];
+
+    for (rid = 0; rid < RULE_ID_SENTINEL && out < list_size - invalid; rid++) {
+        for (; rule_count[rid] > 0; rule_count[rid]--)
+            rule_list[out++] = (RULE_ID_e)rid;
     }
 }
 
@@ -417,8 +406,10 @@ void rule_status_map_reset(void)
 /**
  * @brief Get the index of an alias rule in alias_rule_map.
  *
- * Performs a linear scan over the compile-time `alias_rule_map` and returns
- * the zero-based index of the entry whose `alias_rule_id` matches the input.
+ * Uses the generated alias_rule_map_slot table for a constant-time lookup.
+ * If the generated plan has no matching entry (stale rule_alias_plan.c, or
+ * a different alias map size), falls back to a linear scan of
+ * `alias_rule_map`.
  * If no entry matches, returns `INVALID_IDX`.
  *
  * @param alias_rule_id Alias rule identifier to look up.
@@ -429,9 +420,21 @@ alias_rule_map_get_index(RULE_ID_e alias_rule_id)
 {
 
     uint32_t i;
+    uint32_t slot;
+
+    if ((uint32_t)alias_rule_id >= RULE_ID_SENTINEL)
+        return INVALID_IDX;
+
+    if (alias_rule_plan_count == alias_rule_map_count) {
+        slot = alias_rule_map_slot[alias_rule_id];
+        if ((slot != 0) && (alias_rule_map[slot - 1].alias_rule_id == alias_rule_id))
+            return slot - 1;
+    }
 
-    /* Iterate over all entries in the alias map */
-    for (i = 0; i <  alias_rule_map_count; i++) {
+    /* No match in the generated plan. It may be out of date, for example
+       for an alias added or renamed since it was generated, so iterate over
+       all entries in the alias map */
+    for (i = 0; i < alias_rule_map_count; i++) {
         /* Check if the current entry's alias matches the requested ID */
         if (alias_rule_map[i].alias_rule_id == alias_rule_id) {
             return i;  /* found: return its index */
@@ -57,40 +57,79 @@ static uint32_t check_rule_support(RULE_ID_e rule_id)
     return TEST_SUPPORTED; /* supported on current PAL */
 }
 
+/* Bitmap helpers for O(1) membership checks keyed by rule or module id */
+#define SEL_BITMAP_WORDS(n)       (((n) + 31u) / 32u)
+#define SEL_BITMAP_SET(map, id)   ((map)[(uint32_t)(id) >> 5] |= (1u << ((uint32_t)(id) & 31u)))
+#define SEL_BITMAP_TEST(map, id)  (((map)[(uint32_t)(id) >> 5] >> ((uint32_t)(id) & 31u)) & 1u)
+
+/* Skip lookups built from the run request by build_skip_lookup() */
+static uint32_t skip_rule_bitmap[SEL_BITMAP_WORDS(RULE_ID_SENTINEL)];
+static uint32_t skip_module_bitmap[SEL_BITMAP_WORDS(MODULE_ID_SENTINEL)];
+
+/* Selected arch table (-a) indexed by rule id, built by load_arch_table() */
+static uint32_t arch_rule_bitmap[SEL_BITMAP_WORDS(RULE_ID_SENTINEL)];
+static uint8_t  arch_rule_level[RULE_ID_SENTINEL];
+static uint8_t  arch_rule_sw_view[RULE_ID_SENTINEL];
+
 /**
- * @brief Determine if a rule should be skipped based on CLI options.
+ * @brief Build rule and module skip bitmaps from the run request.
  *
- * Checks whether the provided rule ID is present in the explicit skip list
- * (-skip) or whether its module is present in the skip-modules list
- * (-skipmodule).
+ * Converts the -skip and -skipmodule lists into bitmaps so later membership
+ * checks are constant time regardless of list length.
  *
- * @param rule_id Rule identifier to check.
- * @return true (1) if the rule should be skipped, false(0) otherwise.
+ * @param ctx Run request containing CLI selections.
  */
-static bool is_rule_skipped(const acs_run_request_t *ctx, RULE_ID_e rule_id)
+static void build_skip_lookup(const acs_run_request_t *ctx)
 {
     uint32_t i;
-    MODULE_NAME_e module;
+
+    val_memory_set(skip_rule_bitmap, sizeof(skip_rule_bitmap), 0);
+    val_memory_set(skip_module_bitmap, sizeof(skip_module_bitmap), 0);
 
     if (ctx == NULL)
-        return 0;
+        return;
 
-    /* Check explicit rule skip list (-skip) */
     if (ctx->skip_rule_count > 0 && ctx->skip_rule_list != NULL) {
         for (i = 0; i < ctx->skip_rule_count; i++) {
-            if (ctx->skip_rule_list[i] == rule_id)
-                return 1;
+            if ((uint32_t)ctx->skip_rule_list[i] < RULE_ID_SENTINEL)
+                SEL_BITMAP_SET(skip_rule_bitmap, ctx->skip_rule_list[i]);
         }
     }
 
-    /* Check module skip list (-skipmodule) */
     if (ctx->num_skip_modules > 0 && ctx->skip_modules != NULL) {
-        module = rule_test_map[rule_id].module_id;
         for (i = 0; i < ctx->num_skip_modules; i++) {
-            if (ctx->skip_modules[i] == (uint32_t)module)
-                return 1;
+            if (ctx->skip_modules[i] < MODULE_ID_SENTINEL)
+                SEL_BITMAP_SET(skip_module_bitmap, ctx->skip_modules[i]);
         }
     }
+}
+
+/**
+ * @brief Determine if a rule should be skipped based on CLI options.
+ *
+ * Checks whether the provided rule ID is present in the explicit skip list
+ * (-skip) or whether its module is present in the skip-modules list
+ * (-skipmodule). Requires build_skip_lookup() for the current run request.
+ *
+ * @param rule_id Rule identifier to check.
+ * @return true (1) if the rule should be skipped, false(0) otherwise.
+ */
+static bool is_rule_skipped(RULE_ID_e rule_id)
+{
+    MODULE_NAME_e module;
+
+    if ((uint32_t)rule_id >= RULE_ID_SENTINEL)
+        return 0;
+
+    /* Check explicit rule skip list (-skip) */
+    if (SEL_BITMAP_TEST(skip_rule_bitmap, rule_id))
+        return 1;
+
+    /* Check module skip list (-skipmodule) */
+    module = rule_test_map[rule_id].module_id;
+    if ((uint32_t)module < MODULE_ID_SENTINEL &&
+        SEL_BITMAP_TEST(skip_module_bitmap, module))
+        return 1;
 
     return 0;
 }
@@ -167,6 +206,9 @@ static void print_alias_walk_banner(RULE_ID_e rule_id, uint32_t indent, bool sta
  * rule. Recursive child invocations set @p report_self so child rules print
  * their own headers/status. All recursive descendants use a fixed indentation
  * level to keep logs tidy while still surfacing intermediate alias rules.
+ * A rule that already has a status in rule_status_map for this run is not
+ * executed again; its recorded status is reported instead. Each execution is
+ * timed and recorded in the rule profile.
  *
  * @param ctx           Run request containing CLI selections.
  * @param rule_id       Rule to execute.
@@ -186,6 +228,7 @@ static uint32_t execute_rule_recursive(const acs_run_request_t *ctx,
     bool test_pass_flag;
     bool test_warn_flag;
     bool pushed = 0;
+    bool reused = 0;
     uint32_t j;
     uint32_t alias_rule_map_index;
     uint32_t rule_test_status = TEST_STATE_UNKNOWN;
@@ -194,16 +237,17 @@ static uint32_t execute_rule_recursive(const acs_run_request_t *ctx,
     uint32_t rule_support_status;
     RULE_ID_e child_rule_id;
     const RULE_ID_e *child_rule_list;
+    uint64_t start_ticks = syscounter_read();
+    uint64_t start_payload_ticks = val_get_test_payload_ticks();
 
-    /* Detect accidental alias cycles such as A -> B -> A before descending */
-    if (rule_reference_path_contains(rule_id)) {
-        val_print(ERROR, " Recursive alias reference detected for rule: ");
-        val_print(ERROR, rule_id_string[rule_id]);
-        return RESULT_FAIL(1);
-    }
-
+    /* Alias cycles and over-deep chains are rejected when rule_alias_plan.c is
+       generated. The push still refuses both, so a stale plan cannot recurse
+       without bound; only the failure path works out which one it was */
     if (!rule_reference_path_push(rule_id)) {
-        val_print(ERROR, " Rule reference path depth exceeded for rule: ");
+        if (rule_reference_path_contains(rule_id))
+            val_print(ERROR, " Recursive alias reference detected for rule: ");
+        else
+            val_print(ERROR, " Rule reference path depth exceeded for rule: ");
         val_print(ERROR, rule_id_string[rule_id]);
         return RESULT_FAIL(1);
     }
@@ -230,6 +274,16 @@ static uint32_t execute_rule_recursive(const acs_run_request_t *ctx,
         }
     }
 
+    /* A rule shared between aliases (or also selected at top level) runs once
+       per suite run; later references reuse the memoised result */
+    if (rule_status_map[rule_id] != TEST_STATE_UNKNOWN) {
+        val_print(DEBUG, "\n       Reusing result from earlier execution of ");
+        val_print(DEBUG, rule_id_string[rule_id]);
+        rule_test_status = rule_status_map[rule_id];
+        reused = 1;
+        goto exit_rule;
+    }
+
     if (rule_test_map[rule_id].flag == ALIAS_RULE) {
         alias_rule_map_index = alias_rule_map_get_index(rule_id);
         if (alias_rule_map_index == INVALID_IDX) {
@@ -260,7 +314,7 @@ static uint32_t execute_rule_recursive(const acs_run_request_t *ctx,
         for (j = 0; child_rule_list[j] != RULE_ID_SENTINEL; j++) {
             child_rule_id = child_rule_list[j];
 
-            if (is_rule_skipped(ctx, child_rule_id)) {
+            if (is_rule_skipped(child_rule_id)) {
                 continue;
             }
 
@@ -315,6 +369,11 @@ exit_rule:
         rule_reference_path_pop();
     }
 
+    if (!reused) {
+        rule_profile_record(rule_id, syscounter_read() - start_ticks,
+                            val_get_test_payload_ticks() - start_payload_ticks, indent == 0);
+    }
+
     if (report_self) {
         /* Child rules report themselves inside the recursive walk. Top-level
            rules are still reported exactly once by run_tests(). */
@@ -325,6 +384,107 @@ exit_rule:
     return rule_test_status;
 }
 
+/**
+ * @brief Read one entry of the rule lookup table for an architecture.
+ *
+ * Gives a uniform view over the per-architecture rule tables in
+ * rule_lookup.c so callers do not need one loop per table type.
+ *
+ * @param arch     Architecture selection (-a).
+ * @param idx      Entry index in the table.
+ * @param rule_id  Output rule id; RULE_ID_SENTINEL at end of table.
+ * @param level    Output level of the rule.
+ * @param sw_view  Output BSA software view (SW_OS for other architectures).
+ */
+static void arch_table_entry(ARCH_SEL_e arch, uint32_t idx, RULE_ID_e *rule_id,
+                             uint32_t *level, uint32_t *sw_view)
+{
+    *rule_id = RULE_ID_SENTINEL;
+    *level = 0;
+    *sw_view = SW_OS;
+
+    switch (arch) {
+    case ARCH_BSA:
+        *rule_id = bsa_rule_list[idx].rule_id;
+        *level = (uint32_t)bsa_rule_list[idx].level;
+        *sw_view = (uint32_t)bsa_rule_list[idx].sw_view;
+        break;
+    case ARCH_SBSA:
+        *rule_id = sbsa_rule_list[idx].rule_id;
+        *level = (uint32_t)sbsa_rule_list[idx].level;
+        break;
+    case ARCH_PCBSA:
+        *rule_id = pcbsa_rule_list[idx].rule_id;
+        *level = (uint32_t)pcbsa_rule_list[idx].level;
+        break;
+    case ARCH_VBSA:
+        *rule_id = vbsa_rule_list[idx].rule_id;
+        *level = (uint32_t)vbsa_rule_list[idx].level;
+        break;
+    case ARCH_PFDI:
+        *rule_id = pfdi_rule_list[idx].rule_id;
+        *level = (uint32_t)pfdi_rule_list[idx].level;
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Get the FR level for an architecture's rule table.
+ *
+ * @param arch Architecture selection (-a).
+ * @return *_LEVEL_FR value, or INVALID_IDX if the architecture has no FR
+ *         level (FR filtering then keeps every rule).
+ */
+static uint32_t arch_fr_level(ARCH_SEL_e arch)
+{
+    switch (arch) {
+    case ARCH_BSA:
+        return (uint32_t)BSA_LEVEL_FR;
+    case ARCH_SBSA:
+        return (uint32_t)SBSA_LEVEL_FR;
+    case ARCH_PCBSA:
+        return (uint32_t)PCBSA_LEVEL_FR;
+    case ARCH_VBSA:
+        return (uint32_t)VBSA_LEVEL_FR;
+    default:
+        return INVALID_IDX;
+    }
+}
+
+/**
+ * @brief Index the selected architecture's rule table by rule id.
+ *
+ * @param arch Architecture selection (-a).
+ * @return Number of entries in the table.
+ */
+static uint32_t load_arch_table(ARCH_SEL_e arch)
+{
+    uint32_t count = 0;
+    uint32_t level;
+    uint32_t sw_view;
+    RULE_ID_e rid;
+
+    val_memory_set(arch_rule_bitmap, sizeof(arch_rule_bitmap), 0);
+
+    if (arch == ARCH_NONE)
+        return 0;
+
+    for (arch_table_entry(arch, count, &rid, &level, &sw_view);
+         rid != RULE_ID_SENTINEL;
+         arch_table_entry(arch, ++count, &rid, &level, &sw_view)) {
+        if ((uint32_t)rid >= RULE_ID_SENTINEL || SEL_BITMAP_TEST(arch_rule_bitmap, rid))
+            continue;
+        /* First entry wins, matching the previous table scan order */
+        SEL_BITMAP_SET(arch_rule_bitmap, rid);
+        arch_rule_level[rid] = (uint8_t)level;
+        arch_rule_sw_view[rid] = (uint8_t)sw_view;
+    }
+
+    return count;
+}
+
 /**
  * @brief Filter the provided rule list in place based on CLI selections.
  *
@@ -335,8 +495,10 @@ exit_rule:
  * - If ctx->execute_modules is provided and non-empty, only rules whose module
  *   is in that list are kept.
  *
- * No new memory is allocated. Elements beyond the returned count remain
- * unchanged but are considered out of range by callers.
+ * Membership checks use bitmaps indexed by rule and module id, so the merge
+ * and the filter are linear in the number of rules. A new list is allocated
+ * only when an architecture table (-a) is merged in. Elements beyond the
+ * returned count remain unchanged but are considered out of range by callers.
  *
  * @return New count of rules after filtering.
  */
@@ -344,117 +506,54 @@ uint32_t filter_rule_list_by_cli(acs_run_request_t *ctx)
 {
     uint32_t out;
     uint32_t i;
-    uint32_t si;
-    uint32_t mi;
+    uint32_t add_count;
+    uint32_t fr_level;
+    uint32_t level;
+    uint32_t sw_view;
+    uint32_t select_module_bitmap[SEL_BITMAP_WORDS(MODULE_ID_SENTINEL)];
+    uint32_t seen_bitmap[SEL_BITMAP_WORDS(RULE_ID_SENTINEL)];
     RULE_ID_e rule;
+    RULE_ID_e *new_list;
+    uint32_t new_count;
     bool skip;
+    bool level_filter;
     MODULE_NAME_e module;
-    bool found;
-    /* Pointers to lookup tables for selected arch (if any) */
-    const bsa_rule_entry_t   *bsa_tbl   = NULL;
-    const sbsa_rule_entry_t  *sbsa_tbl  = NULL;
-    const pcbsa_rule_entry_t *pcbsa_tbl = NULL;
-    const vbsa_rule_entry_t  *vbsa_tbl  = NULL;
-    const pfdi_rule_entry_t  *pfdi_tbl  = NULL;
-    uint32_t tbl_count = 0;
 
     if (ctx == NULL)
         return 0;
 
-    /* If architecture is selected (-a), merge its rules into the list, deduped */
-    if (ctx->arch_selection != ARCH_NONE) {
-        uint32_t add_count = 0;
-
-        if (ctx->arch_selection == ARCH_BSA) {
-            /* count BSA entries */
-            while (bsa_rule_list[add_count].rule_id != RULE_ID_SENTINEL)
-                add_count++;
-            bsa_tbl = bsa_rule_list;
-        } else if (ctx->arch_selection == ARCH_SBSA) {
-            while (sbsa_rule_list[add_count].rule_id != RULE_ID_SENTINEL)
-                add_count++;
-            sbsa_tbl = sbsa_rule_list;
-        } else if (ctx->arch_selection == ARCH_PCBSA) {
-            while (pcbsa_rule_list[add_count].rule_id != RULE_ID_SENTINEL)
-                add_count++;
-            pcbsa_tbl = pcbsa_rule_list;
-        } else if (ctx->arch_selection == ARCH_VBSA) {
-            while (vbsa_rule_list[add_count].rule_id != RULE_ID_SENTINEL)
-                add_count++;
-            vbsa_tbl = vbsa_rule_list;
-        } else if (ctx->arch_selection == ARCH_PFDI) {
-            while (pfdi_rule_list[add_count].rule_id != RULE_ID_SENTINEL)
-                add_count++;
-            pfdi_tbl = pfdi_rule_list;
-        }
+    add_count = load_arch_table(ctx->arch_selection);
 
-        if (add_count > 0) {
-            /* Allocate a new buffer sized for worst-case unique merge */
-            RULE_ID_e *old_list = ctx->rule_list;
-            uint32_t old_count = ctx->rule_count;
-            RULE_ID_e *new_list = (RULE_ID_e *)val_memory_alloc((old_count + add_count)
-                                   * sizeof(RULE_ID_e));
-            if (new_list != NULL) {
-                /* Copy existing */
-                for (i = 0; i < old_count; i++) new_list[i] = old_list[i];
-                uint32_t new_count = old_count;
-                /* Append unique entries from table */
-                if (bsa_tbl) {
-                    for (i = 0; i < add_count; i++) {
-                        RULE_ID_e rid = bsa_tbl[i].rule_id;
-                        if (!rule_in_list(rid, new_list, new_count))
-                            new_list[new_count++] = rid;
-                    }
-                } else if (sbsa_tbl) {
-                    for (i = 0; i < add_count; i++) {
-                        RULE_ID_e rid = sbsa_tbl[i].rule_id;
-                        if (!rule_in_list(rid, new_list, new_count))
-                            new_list[new_count++] = rid;
-                    }
-                } else if (pcbsa_tbl) {
-                    for (i = 0; i < add_count; i++) {
-                        RULE_ID_e rid = pcbsa_tbl[i].rule_id;
-                        if (!rule_in_list(rid, new_list, new_count))
-                            new_list[new_count++] = rid;
-                    }
-                } else if (vbsa_tbl) {
-                    for (i = 0; i < add_count; i++) {
-                        RULE_ID_e rid = vbsa_tbl[i].rule_id;
-                        if (!rule_in_list(rid, new_list, new_count))
-                            new_list[new_count++] = rid;
-                    }
-                } else if (pfdi_tbl) {
-                    for (i = 0; i < add_count; i++) {
-                        RULE_ID_e rid = pfdi_tbl[i].rule_id;
-                        if (!rule_in_list(rid, new_list, new_count))
-                            new_list[new_count++] = rid;
-                    }
+    /* If architecture is selected (-a), merge its rules into the list, deduped */
+    if (add_count > 0) {
+        /* Allocate a new buffer sized for worst-case unique merge */
+        new_list = (RULE_ID_e *)val_memory_alloc((ctx->rule_count + add_count)
+                                                 * sizeof(RULE_ID_e));
+        if (new_list != NULL) {
+            val_memory_set(seen_bitmap, sizeof(seen_bitmap), 0);
+
+            /* Copy existing, keeping user duplicates as before */
+            for (i = 0; i < ctx->rule_count; i++) {
+                new_list[i] = ctx->rule_list[i];
+                if ((uint32_t)new_list[i] < RULE_ID_SENTINEL)
+                    SEL_BITMAP_SET(seen_bitmap, new_list[i]);
+            }
+            new_count = ctx->rule_count;
+
+            /* Append unique entries from table */
+            for (i = 0; i < add_count; i++) {
+                arch_table_entry(ctx->arch_selection, i, &rule, &level, &sw_view);
+                if (!SEL_BITMAP_TEST(seen_bitmap, rule)) {
+                    SEL_BITMAP_SET(seen_bitmap, rule);
+                    new_list[new_count++] = rule;
                 }
-
-                if (ctx->rule_list_owned && old_list != NULL)
-                    val_memory_free(old_list);
-                ctx->rule_list = new_list;
-                ctx->rule_count = new_count;
-                ctx->rule_list_owned = true;
             }
-        }
 
-        /* Also capture the selected table pointer and count for filtering by level */
-        if (ctx->arch_selection == ARCH_BSA) {
-            bsa_tbl = bsa_rule_list;
-            while (bsa_tbl[tbl_count].rule_id != RULE_ID_SENTINEL) tbl_count++;
-        } else if (ctx->arch_selection == ARCH_SBSA) {
-            sbsa_tbl = sbsa_rule_list;
-            while (sbsa_tbl[tbl_count].rule_id != RULE_ID_SENTINEL) tbl_count++;
-        } else if (ctx->arch_selection == ARCH_PCBSA) {
-            pcbsa_tbl = pcbsa_rule_list;
-            while (pcbsa_tbl[tbl_count].rule_id != RULE_ID_SENTINEL) tbl_count++;
-        } else if (ctx->arch_selection == ARCH_VBSA) {
-            vbsa_tbl = vbsa_rule_list;
-            while (vbsa_tbl[tbl_count].rule_id != RULE_ID_SENTINEL) tbl_count++;
-        } else if (ctx->arch_selection == ARCH_PFDI) {
-            pfdi_tbl = pfdi_rule_list;
-            while (pfdi_tbl[tbl_count].rule_id != RULE_ID_SENTINEL) tbl_count++;
+            if (ctx->rule_list_owned && ctx->rule_list != NULL)
+                val_memory_free(ctx->rule_list);
+            ctx->rule_list = new_list;
+            ctx->rule_count = new_count;
+            ctx->rule_list_owned = true;
         }
     }
 
@@ -462,150 +561,56 @@ uint32_t filter_rule_list_by_cli(acs_run_request_t *ctx)
     if (ctx->rule_list == NULL || ctx->rule_count == 0)
         return 0;
 
+    build_skip_lookup(ctx);
+
+    val_memory_set(select_module_bitmap, sizeof(select_module_bitmap), 0);
+    if (ctx->num_modules > 0 && ctx->execute_modules != NULL) {
+        for (i = 0; i < ctx->num_modules; i++) {
+            if (ctx->execute_modules[i] < MODULE_ID_SENTINEL)
+                SEL_BITMAP_SET(select_module_bitmap, ctx->execute_modules[i]);
+        }
+    }
+
+    /* Level-based filtering and software view filtering (BSA) */
+    level_filter = (ctx->arch_selection != ARCH_NONE) &&
+                   (ctx->level_filter_mode != LVL_FILTER_NONE ||
+                    (ctx->arch_selection == ARCH_BSA && ctx->bsa_sw_view_mask != 0));
+    fr_level = arch_fr_level(ctx->arch_selection);
+
     out = 0;
     for (i = 0; i < ctx->rule_count; i++) {
         rule = ctx->rule_list[i];
-        skip = 0;
 
-        /* Skip explicit rule IDs provided via -skip */
-        if (!skip && ctx->skip_rule_count > 0 && ctx->skip_rule_list != NULL) {
-            for (si = 0; si < ctx->skip_rule_count; si++) {
-                if (ctx->skip_rule_list[si] == rule) {
-                    skip = 1;
-                    break;
-                }
-            }
-        }
+        /* Skip explicit rule IDs (-skip) and modules listed in -skipmodule */
+        skip = is_rule_skipped(rule);
 
         module = rule_test_map[rule].module_id;
 
-        /* Skip rules belonging to modules listed in -skipmodule */
-        if (!skip && ctx->num_skip_modules > 0 && ctx->skip_modules != NULL) {
-            for (mi = 0; mi < ctx->num_skip_modules; mi++) {
-                if (ctx->skip_modules[mi] == (uint32_t)module) {
-                    skip = 1;
-                    break;
-                }
-            }
-        }
-
         /* If -m provided, keep only selected modules */
         if (!skip && ctx->num_modules > 0 && ctx->execute_modules != NULL) {
-            found = 0;
-            for (mi = 0; mi < ctx->num_modules; mi++) {
-                if (ctx->execute_modules[mi] == (uint32_t)module) {
-                    found = 1;
-                    break; }
-            }
-            if (!found)
+            if ((uint32_t)module >= MODULE_ID_SENTINEL ||
+                !SEL_BITMAP_TEST(select_module_bitmap, module))
                 skip = 1;
         }
 
-        /* Level-based filtering and software view filtering (BSA) */
-        if (!skip && ctx->arch_selection != ARCH_NONE) {
-            if (ctx->level_filter_mode != LVL_FILTER_NONE ||
-                (ctx->arch_selection == ARCH_BSA && ctx->bsa_sw_view_mask != 0)) {
-                /* Find rule in the selected arch table */
-                bool found_entry = 0;
-                if (bsa_tbl) {
-                    for (uint32_t ti = 0; ti < tbl_count; ti++) {
-                        if (bsa_tbl[ti].rule_id == rule) {
-                            found_entry = 1;
-                            /* Software view filter if requested: keep if any selected */
-                            if (ctx->bsa_sw_view_mask != 0) {
-                                uint32_t bit = (1u << (uint32_t)bsa_tbl[ti].sw_view);
-                                if ((ctx->bsa_sw_view_mask & bit) == 0) {
-                                    skip = 1;
-                                    break;
-                                }
-                            }
-                            /* Level filtering */
-                            if (ctx->level_filter_mode == LVL_FILTER_FR) {
-                                /* Treat FR mode as MAX up to FR */
-                                if ((uint32_t)bsa_tbl[ti].level > (uint32_t)BSA_LEVEL_FR)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_ONLY) {
-                                if ((uint32_t)bsa_tbl[ti].level != ctx->level_value)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_MAX) {
-                                if ((uint32_t)bsa_tbl[ti].level > ctx->level_value)
-                                    skip = 1;
-                            }
-                            break;
-                        }
-                    }
-                } else if (sbsa_tbl) {
-                    for (uint32_t ti = 0; ti < tbl_count; ti++) {
-                        if (sbsa_tbl[ti].rule_id == rule) {
-                            found_entry = 1;
-                            if (ctx->level_filter_mode == LVL_FILTER_FR) {
-                                /* Treat FR mode as MAX up to FR */
-                                if ((uint32_t)sbsa_tbl[ti].level > (uint32_t)SBSA_LEVEL_FR)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_ONLY) {
-                                if ((uint32_t)sbsa_tbl[ti].level != ctx->level_value)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_MAX) {
-                                if ((uint32_t)sbsa_tbl[ti].level > ctx->level_value)
-                                    skip = 1;
-                            }
-                            break;
-                        }
-                    }
-                } else if (pcbsa_tbl) {
-                    for (uint32_t ti = 0; ti < tbl_count; ti++) {
-                        if (pcbsa_tbl[ti].rule_id == rule) {
-                            found_entry = 1;
-                            if (ctx->level_filter_mode == LVL_FILTER_FR) {
-                                /* Treat FR mode as MAX up to FR */
-                                if ((uint32_t)pcbsa_tbl[ti].level > (uint32_t)PCBSA_LEVEL_FR)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_ONLY) {
-                                if ((uint32_t)pcbsa_tbl[ti].level != ctx->level_value)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_MAX) {
-                                if ((uint32_t)pcbsa_tbl[ti].level > ctx->level_value)
-                                    skip = 1;
-                            }
-                            break;
-                        }
-                    }
-                } else if (vbsa_tbl) {
-                    for (uint32_t ti = 0; ti < tbl_count; ti++) {
-                        if (vbsa_tbl[ti].rule_id == rule) {
-                            found_entry = 1;
-                            if (ctx->level_filter_mode == LVL_FILTER_FR) {
-                                /* Treat FR mode as MAX up to FR */
-                                if ((uint32_t)vbsa_tbl[ti].level > (uint32_t)VBSA_LEVEL_FR)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_ONLY) {
-                                if ((uint32_t)vbsa_tbl[ti].level != ctx->level_value)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_MAX) {
-                                if ((uint32_t)vbsa_tbl[ti].level > ctx->level_value)
-                                    skip = 1;
-                            }
-                            break;
-                        }
-                    }
-                } else if (pfdi_tbl) {
-                    for (uint32_t ti = 0; ti < tbl_count; ti++) {
-                        if (pfdi_tbl[ti].rule_id == rule) {
-                            found_entry = 1;
-                            if (ctx->level_filter_mode == LVL_FILTER_ONLY) {
-                                if ((uint32_t)pfdi_tbl[ti].level != ctx->level_value)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_MAX) {
-                                if ((uint32_t)pfdi_tbl[ti].level > ctx->level_value)
-                                    skip = 1;
-                            }
-                            break;
-                        }
-                    }
-                }
+        /* Rules not present in the selected arch table are kept */
+        if (!skip && level_filter && SEL_BITMAP_TEST(arch_rule_bitmap, rule)) {
+            level = arch_rule_level[rule];
 
-                /* If not found in table, conservatively skip or keep? Keep by default */
-                (void)found_entry; /* silence unused if not used */
+            /* Software view filter if requested: keep if any selected */
+            if (ctx->arch_selection == ARCH_BSA && ctx->bsa_sw_view_mask != 0 &&
+                (ctx->bsa_sw_view_mask & (1u << arch_rule_sw_view[rule])) == 0) {
+                skip = 1;
+            } else if (ctx->level_filter_mode == LVL_FILTER_FR) {
+                /* Treat FR mode as MAX up to FR */
+                if (fr_level != INVALID_IDX && level > fr_level)
+                    skip = 1;
+            } else if (ctx->level_filter_mode == LVL_FILTER_ONLY) {
+                if (level != ctx->level_value)
+                    skip = 1;
+            } else if (ctx->level_filter_mode == LVL_FILTER_MAX) {
+                if (level > ctx->level_value)
+                    skip = 1;
             }
         }
 
@@ -623,7 +628,8 @@ uint32_t filter_rule_list_by_cli(acs_run_request_t *ctx)
  * Assumes the list has already been filtered for CLI selections (-skip, -m,
  * -skipmodule). Sorts for module-wise execution, checks PAL support, and for
  * alias rules recursively executes their child rules while aggregating status.
- * Records and prints status per rule.
+ * Records and prints status per rule, then prints the timing profile report
+ * if one was requested, and dumps the deferred log when it is enabled.
  *
  */
 void
@@ -635,6 +641,7 @@ run_tests(const acs_run_request_t *ctx)
     uint32_t num_pe;
     RULE_ID_e *rule_list;
     uint32_t list_size;
+    uint32_t *sort_scratch;
 
     if (ctx == NULL || ctx->rule_list == NULL || ctx->rule_count == 0)
         return;
@@ -646,13 +653,25 @@ run_tests(const acs_run_request_t *ctx)
 
     /* Initialize per-rule status map to TEST_STATUS_UNKNOWN for this run */
     rule_status_map_reset();
+    rule_profile_reset();
+
+    /* Alias children are checked against -skip/-skipmodule while walking */
+    build_skip_lookup(ctx);
 
     /* Get number of PEs in the system */
     num_pe = val_pe_get_num();
 
-    /* quick sort the rule list so that it is module wise as in RULE_ID_e typedef definition */
-    quick_sort_rule_list(rule_list, list_size);
-
+    /* sort the rule list so that it is module wise as in RULE_ID_e typedef definition */
+    sort_scratch = val_memory_calloc(RULE_ID_SENTINEL, sizeof(uint32_t));
+    sort_rule_list(rule_list, list_size, sort_scratch);
+    if (sort_scratch != NULL)
+        val_memory_free(sort_scratch);
+
+    /* Rules run one at a time on the primary PE, the wait-bound timer,
+       watchdog and wakeup rules included. They are not overlapped on
+       secondary PEs: the exception and ISR hooks, the val_set_status slots
+       and the logger are shared VAL state rather than per-PE, so two rules
+       in flight would corrupt each other's results. */
     for (i = 0 ; i < list_size; i++) {
         rule_reference_path_reset();
 
@@ -684,4 +703,7 @@ report_status:
     }
     val_print(INFO,
               "\n-------------------- Suite run complete --------------------\n");
+
+    rule_profile_print_report();
+    val_log_deferred_dump();
 }
@@ -0,0 +1,373 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "rule_based_execution.h"
+#include "val_interface.h"
+#include "acs_memory.h"
+#include "acs_execution_policy.h"
+#ifdef TARGET_LINUX
+#include "val_sysreg_timer.h"
+#endif
+
+extern rule_test_map_t rule_test_map[RULE_ID_SENTINEL];
+extern char *rule_id_string[RULE_ID_SENTINEL];
+extern char *module_name_string[MODULE_ID_SENTINEL];
+
+/* Per-rule timing sample. Times are inclusive of alias children. */
+typedef struct {
+    uint64_t ticks;          /* Counter ticks spent executing the rule */
+    uint64_t payload_ticks;  /* Portion spent inside val_run_test_payload() */
+    uint32_t run_count;      /* Times the rule was executed in this run */
+} rule_profile_t;
+
+/* Named init phase (info table creation etc.) timed outside run_tests() */
+typedef struct {
+    const char8_t *name;
+    uint64_t       start;
+    uint64_t       ticks;
+} rule_profile_phase_t;
+
+static rule_profile_t       rule_profile_map[RULE_ID_SENTINEL];
+static uint64_t             module_profile_ticks[MODULE_ID_SENTINEL];
+static uint32_t             module_profile_rules[MODULE_ID_SENTINEL];
+static rule_profile_phase_t rule_profile_phase[RULE_PROFILE_PHASE_MAX];
+static uint32_t             rule_profile_phase_count;
+static uint32_t             rule_profile_phase_open = RULE_PROFILE_PHASE_MAX;
+static uint64_t             rule_profile_run_ticks;
+
+/**
+ * @brief Clear all per-rule and per-module samples before a run.
+ *
+ * Phase samples are preserved since info tables are created before
+ * run_tests() resets the rule samples.
+ */
+void rule_profile_reset(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < RULE_ID_SENTINEL; i++) {
+        rule_profile_map[i].ticks = 0;
+        rule_profile_map[i].payload_ticks = 0;
+        rule_profile_map[i].run_count = 0;
+    }
+
+    for (i = 0; i < MODULE_ID_SENTINEL; i++) {
+        module_profile_ticks[i] = 0;
+        module_profile_rules[i] = 0;
+    }
+
+    rule_profile_run_ticks = 0;
+}
+
+/**
+ * @brief Account one execution of a rule.
+ *
+ * @param rule_id       Rule that was executed.
+ * @param ticks         Inclusive counter ticks for the execution.
+ * @param payload_ticks Ticks spent in PE payloads during the execution.
+ * @param top_level     True if the rule was selected directly (not reached
+ *                      through an alias); only these count towards module
+ *                      totals so that alias children are not double counted.
+ */
+void rule_profile_record(RULE_ID_e rule_id, uint64_t ticks, uint64_t payload_ticks,
+                         bool top_level)
+{
+    MODULE_NAME_e module;
+
+    if (rule_id >= RULE_ID_SENTINEL)
+        return;
+
+    rule_profile_map[rule_id].ticks += ticks;
+    rule_profile_map[rule_id].payload_ticks += payload_ticks;
+    rule_profile_map[rule_id].run_count++;
+
+    if (!top_level)
+        return;
+
+    rule_profile_run_ticks += ticks;
+
+    module = rule_test_map[rule_id].module_id;
+    if ((uint32_t)module < MODULE_ID_SENTINEL) {
+        module_profile_ticks[module] += ticks;
+        module_profile_rules[module]++;
+    }
+}
+
+/**
+ * @brief Start timing a named init phase such as info table creation.
+ *
+ * Phases do not nest; starting a new phase while one is open closes the
+ * previous one. Phases beyond RULE_PROFILE_PHASE_MAX are ignored.
+ *
+ * @param name Static string naming the phase.
+ */
+void rule_profile_phase_begin(const char8_t *name)
+{
+    if (rule_profile_phase_open != RULE_PROFILE_PHASE_MAX)
+        rule_profile_phase_end();
+
+    if (rule_profile_phase_count >= RULE_PROFILE_PHASE_MAX)
+        return;
+
+    rule_profile_phase_open = rule_profile_phase_count++;
+    rule_profile_phase[rule_profile_phase_open].name = name;
+    rule_profile_phase[rule_profile_phase_open].ticks = 0;
+    rule_profile_phase[rule_profile_phase_open].start = syscounter_read();
+}
+
+/**
+ * @brief Stop timing the currently open init phase, if any.
+ */
+void rule_profile_phase_end(void)
+{
+    rule_profile_phase_t *phase;
+
+    if (rule_profile_phase_open == RULE_PROFILE_PHASE_MAX)
+        return;
+
+    phase = &rule_profile_phase[rule_profile_phase_open];
+    phase->ticks = syscounter_read() - phase->start;
+    rule_profile_phase_open = RULE_PROFILE_PHASE_MAX;
+}
+
+/**
+ * @brief Get the counter frequency used to convert ticks to microseconds.
+ *
+ * @return Counter frequency in Hz, or 0 if unknown.
+ */
+static uint64_t rule_profile_counter_freq(void)
+{
+#ifdef TARGET_LINUX
+    /* acs_wd.c is not part of the kernel module build */
+    return read_cntfrq_el0();
+#else
+    return val_get_counter_frequency();
+#endif
+}
+
+/**
+ * @brief Convert counter ticks to microseconds without intermediate overflow.
+ *
+ * @param ticks Counter ticks.
+ * @param freq  Counter frequency in Hz.
+ * @return Elapsed time in microseconds, or raw ticks if @p freq is 0.
+ */
+static uint64_t rule_profile_ticks_to_us(uint64_t ticks, uint64_t freq)
+{
+    if (freq == 0)
+        return ticks;
+
+    return ((ticks / freq) * 1000000) + (((ticks % freq) * 1000000) / freq);
+}
+
+/**
+ * @brief Build the list of slowest rules by inclusive time.
+ *
+ * @param top   Output array of rule ids sorted by descending time.
+ * @param max   Capacity of @p top.
+ * @return Number of valid entries in @p top.
+ */
+static uint32_t rule_profile_slowest(RULE_ID_e *top, uint32_t max)
+{
+    uint32_t count = 0;
+    uint32_t rid;
+    uint32_t pos;
+
+    for (rid = 0; rid < RULE_ID_SENTINEL; rid++) {
+        if (rule_profile_map[rid].run_count == 0)
+            continue;
+
+        /* Insertion into a small descending array */
+        pos = count;
+        while (pos > 0 &&
+               rule_profile_map[top[pos - 1]].ticks < rule_profile_map[rid].ticks) {
+            if (pos < max)
+                top[pos] = top[pos - 1];
+            pos--;
+        }
+        if (pos < max) {
+            top[pos] = (RULE_ID_e)rid;
+            if (count < max)
+                count++;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Print human readable summary: slowest rules, modules and phases.
+ */
+static void rule_profile_print_summary(uint64_t freq)
+{
+    RULE_ID_e top[RULE_PROFILE_TOP_N];
+    uint32_t count;
+    uint32_t i;
+
+    val_print(INFO, "\n---------- ACS Profile ----------\n");
+    val_print(INFO, "   Counter frequency (Hz) : %llu\n", freq);
+    val_print(INFO, "   Total rule time (us)   : %llu\n",
+              rule_profile_ticks_to_us(rule_profile_run_ticks, freq));
+
+    if (rule_profile_phase_count) {
+        val_print(INFO, "\n   Init phases (us)\n");
+        for (i = 0; i < rule_profile_phase_count; i++) {
+            val_print(INFO, "   %-22s : ", rule_profile_phase[i].name);
+            val_print(INFO, "%llu\n",
+                      rule_profile_ticks_to_us(rule_profile_phase[i].ticks, freq));
+        }
+    }
+
+    val_print(INFO, "\n   Module time (us)\n");
+    for (i = 0; i < MODULE_ID_SENTINEL; i++) {
+        if (module_profile_rules[i] == 0 || module_name_string[i] == NULL)
+            continue;
+        val_print(INFO, "   %-22s : ", module_name_string[i]);
+        val_print(INFO, "%llu", rule_profile_ticks_to_us(module_profile_ticks[i], freq));
+        val_print(INFO, " (%d rules)\n", module_profile_rules[i]);
+    }
+
+    count = rule_profile_slowest(top, RULE_PROFILE_TOP_N);
+    val_print(INFO, "\n   Slowest rules (us, payload us)\n");
+    for (i = 0; i < count; i++) {
+        val_print(INFO, "   %-22s : ", rule_id_string[top[i]]);
+        val_print(INFO, "%llu, ", rule_profile_ticks_to_us(rule_profile_map[top[i]].ticks, freq));
+        val_print(INFO, "%llu\n",
+                  rule_profile_ticks_to_us(rule_profile_map[top[i]].payload_ticks, freq));
+    }
+    val_print(INFO, "---------------------------------\n");
+}
+
+/**
+ * @brief Print one record per line as JSON objects (JSON Lines).
+ *
+ * Each line is prefixed with "ACS_PROFILE " so it can be extracted from a
+ * mixed console log with a simple grep.
+ */
+static void rule_profile_print_json(uint64_t freq)
+{
+    uint32_t i;
+
+    val_print(INFO, "\nACS_PROFILE {\"type\":\"run\",\"counter_hz\":%llu,", freq);
+    val_print(INFO, "\"total_us\":%llu}\n",
+              rule_profile_ticks_to_us(rule_profile_run_ticks, freq));
+
+    for (i = 0; i < rule_profile_phase_count; i++) {
+        val_print(INFO, "ACS_PROFILE {\"type\":\"phase\",\"name\":\"%s\",",
+                  rule_profile_phase[i].name);
+        val_print(INFO, "\"us\":%llu}\n",
+                  rule_profile_ticks_to_us(rule_profile_phase[i].ticks, freq));
+    }
+
+    for (i = 0; i < MODULE_ID_SENTINEL; i++) {
+        if (module_profile_rules[i] == 0 || module_name_string[i] == NULL)
+            continue;
+        val_print(INFO, "ACS_PROFILE {\"type\":\"module\",\"name\":\"%s\",",
+                  module_name_string[i]);
+        val_print(INFO, "\"rules\":%d,", module_profile_rules[i]);
+        val_print(INFO, "\"us\":%llu}\n",
+                  rule_profile_ticks_to_us(module_profile_ticks[i], freq));
+    }
+
+    for (i = 0; i < RULE_ID_SENTINEL; i++) {
+        if (rule_profile_map[i].run_count == 0)
+            continue;
+        val_print(INFO, "ACS_PROFILE {\"type\":\"rule\",\"name\":\"%s\",", rule_id_string[i]);
+        val_print(INFO, "\"module\":\"%s\",",
+                  module_name_string[rule_test_map[i].module_id]);
+        val_print(INFO, "\"runs\":%d,", rule_profile_map[i].run_count);
+        val_print(INFO, "\"us\":%llu,", rule_profile_ticks_to_us(rule_profile_map[i].ticks, freq));
+        val_print(INFO, "\"payload_us\":%llu}\n",
+                  rule_profile_ticks_to_us(rule_profile_map[i].payload_ticks, freq));
+    }
+}
+
+/**
+ * @brief Print one record per line as CSV with a header row.
+ *
+ * Columns: type,name,module,runs,us,payload_us. Each line is prefixed with
+ * "ACS_PROFILE," so it can be extracted from a mixed console log. Module
+ * rows leave the rule name empty and carry the module in the module column.
+ *
+ * @param freq  Counter frequency in Hz.
+ * @param level Print level for the report.
+ */
+static void rule_profile_print_csv(uint64_t freq, uint32_t level)
+{
+    uint32_t i;
+
+    val_print(level, "\nACS_PROFILE,type,name,module,runs,us,payload_us\n");
+    val_print(level, "ACS_PROFILE,run,total,,,%llu,\n",
+              rule_profile_ticks_to_us(rule_profile_run_ticks, freq));
+
+    for (i = 0; i < rule_profile_phase_count; i++) {
+        val_print(level, "ACS_PROFILE,phase,%s,,1,", rule_profile_phase[i].name);
+        val_print(level, "%llu,\n", rule_profile_ticks_to_us(rule_profile_phase[i].ticks, freq));
+    }
+
+    for (i = 0; i < MODULE_ID_SENTINEL; i++) {
+        if (module_profile_rules[i] == 0 || module_name_string[i] == NULL)
+            continue;
+        val_print(level, "ACS_PROFILE,module,,%s,", module_name_string[i]);
+        val_print(level, "%d,", module_profile_rules[i]);
+        val_print(level, "%llu,\n", rule_profile_ticks_to_us(module_profile_ticks[i], freq));
+    }
+
+    for (i = 0; i < RULE_ID_SENTINEL; i++) {
+        if (rule_profile_map[i].run_count == 0)
+            continue;
+        val_print(level, "ACS_PROFILE,rule,%s,", rule_id_string[i]);
+        val_print(level, "%s,", module_name_string[rule_test_map[i].module_id]);
+        val_print(level, "%d,", rule_profile_map[i].run_count);
+        val_print(level, "%llu,", rule_profile_ticks_to_us(rule_profile_map[i].ticks, freq));
+        val_print(level, "%llu\n",
+                  rule_profile_ticks_to_us(rule_profile_map[i].payload_ticks, freq));
+    }
+}
+
+/**
+ * @brief Print the profile report in the format selected by the execution
+ *        policy (-profile on UEFI).
+ *
+ * Linux kernel module runs cannot receive the option from the app, so they
+ * emit CSV at DEBUG level, for post-processing from dmesg of verbose runs.
+ */
+void rule_profile_print_report(void)
+{
+    uint32_t format = acs_policy_get_profile_format();
+    uint32_t csv_level = INFO;
+    uint64_t freq;
+
+#ifdef TARGET_LINUX
+    if (format == PROFILE_FORMAT_NONE) {
+        format = PROFILE_FORMAT_CSV;
+        csv_level = DEBUG;
+    }
+#endif
+
+    if (format == PROFILE_FORMAT_NONE)
+        return;
+
+    freq = rule_profile_counter_freq();
+
+    if (format == PROFILE_FORMAT_JSON)
+        rule_profile_print_json(freq);
+    else if (format == PROFILE_FORMAT_CSV)
+        rule_profile_print_csv(freq, csv_level);
+    else
+        rule_profile_print_summary(freq);
+}
@@ -6,6 +6,8 @@
  */
 
 #include "val_logger.h"
+#include "val_libc.h"
+#include "acs_execution_policy.h"
 
 enum { LOG_MAX_STRING_LENGTH = 90 };
 
@@ -671,6 +673,308 @@ out:
     return chars_written;
 }
 
+#if defined(TARGET_BAREMETAL)
+/*
+ * Deferred logging (deferred_log execution policy).
+ *
+ * Each val_printf() call is stored as a binary record instead of being
+ * formatted. The format string is kept as an offset into .rodata and only the
+ * arguments are copied, so capturing a DEBUG or TRACE message costs a scan of
+ * the format string. val_log_deferred_dump() prints the buffer after the run;
+ * tools/scripts/acs_log_decode.py formats it on the host using the ELF image.
+ *
+ * Record layout, little endian, each field 8-byte aligned:
+ *   u32  DLOG_REC_MAGIC << 24 | level << 16 | flags
+ *   u32  record size in bytes
+ *   u64  format offset from __RODATA_START__, or a string blob if
+ *        DLOG_REC_FMT_INLINE is set
+ *   then one entry per argument consumed by the format, in order:
+ *   u64 for '*' widths and integer/pointer conversions, a string blob for %s.
+ * A string blob is a u64 length followed by the bytes, padded to 8. Strings
+ * longer than DLOG_STRING_MAX are cut there and DLOG_STRING_TRUNC is set in
+ * the length. An inline format cut that way also sets DLOG_REC_FMT_TRUNC and
+ * its arguments are not recorded, since the decoder cannot match them.
+ *
+ * PEs may log at the same time. A record is sized first, then its space is
+ * claimed with a compare-and-swap on dlog.used and filled in place.
+ */
+#define DLOG_MAGIC            0x31474F4C444B4341ULL   /* "ACSDLOG1" */
+#define DLOG_REC_MAGIC        0xD1u
+#define DLOG_REC_FMT_INLINE   0x1u
+#define DLOG_REC_FMT_TRUNC    0x2u
+#define DLOG_STRING_MAX       256u
+#define DLOG_STRING_TRUNC     (1ULL << 63)
+#define DLOG_NO_SPACE         (~0ULL)
+
+extern char __RODATA_START__[], __RODATA_END__[];
+
+static struct {
+    uint64_t magic;
+    uint64_t rodata_base;
+    uint64_t used;
+    uint64_t dropped;
+    uint8_t  data[DEFERRED_LOG_BUFFER_SIZE];
+} dlog __attribute__((aligned(8)));
+
+/* Record being sized (buf NULL) or written */
+typedef struct {
+    uint8_t  *buf;
+    uint64_t pos;
+} dlog_writer_t;
+
+/**
+ *   @brief    - Claims space for one record in the deferred log
+ *   @param    - size : Record size in bytes
+ *   @return   - Offset of the record in dlog.data, DLOG_NO_SPACE if full
+ **/
+static uint64_t dlog_claim(uint64_t size)
+{
+    uint64_t used = __atomic_load_n(&dlog.used, __ATOMIC_RELAXED);
+
+    do {
+        if (used + size > sizeof(dlog.data))
+            return DLOG_NO_SPACE;
+    } while (!__atomic_compare_exchange_n(&dlog.used, &used, used + size, true,
+                                          __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+    return used;
+}
+
+static void dlog_put_u64(dlog_writer_t *w, uint64_t value)
+{
+    if (w->buf != NULL)
+        *(uint64_t *)(w->buf + w->pos) = value;
+    w->pos += sizeof(uint64_t);
+}
+
+/* Returns true if str was cut at DLOG_STRING_MAX */
+static bool dlog_put_string(dlog_writer_t *w, const char *str)
+{
+    uint64_t len;
+    bool truncated;
+
+    if (str == NULL)
+        str = "(null)";
+
+    len = log_strnlen_s(str, DLOG_STRING_MAX);
+    truncated = (len == DLOG_STRING_MAX) && (str[len] != '\0');
+    dlog_put_u64(w, truncated ? (len | DLOG_STRING_TRUNC) : len);
+
+    if (w->buf != NULL)
+        val_memcpy(w->buf + w->pos, (void *)str, (uint32_t)len);
+    w->pos += (len + 7) & ~7ULL;
+
+    return truncated;
+}
+
+/**
+ *   @brief    - Sizes or writes the body of one record, after its header
+ *   @param    - w    : Writer; with a NULL buffer only the size is counted
+ *             - fmt  : Format string as passed to val_printf
+ *             - args : Arguments for fmt
+ *   @return   - Record flags
+ **/
+static uint32_t dlog_put_record(dlog_writer_t *w, const char *fmt, va_list args)
+{
+    uint32_t flags = 0;
+    bool is_long, is_longlong;
+
+    if ((fmt >= __RODATA_START__) && (fmt < __RODATA_END__)) {
+        dlog_put_u64(w, (uint64_t)(fmt - __RODATA_START__));
+    } else {
+        flags |= DLOG_REC_FMT_INLINE;
+        if (dlog_put_string(w, fmt))
+            return flags | DLOG_REC_FMT_TRUNC;
+    }
+
+    /* Mirror the argument consumption of val_log() */
+    for (; *fmt != '\0'; fmt++) {
+        if (*fmt != '%')
+            continue;
+
+        for (fmt++; (*fmt == '-') || (*fmt == '+') || (*fmt == ' ') ||
+                    (*fmt == '#') || (*fmt == '0'); fmt++)
+            ;
+
+        if (*fmt == '*') {
+            dlog_put_u64(w, (uint64_t)(int64_t)va_arg(args, int));
+            fmt++;
+        } else {
+            while ((*fmt >= '0') && (*fmt <= '9'))
+                fmt++;
+        }
+
+        is_long = false;
+        is_longlong = false;
+        if (*fmt == 'h') {
+            fmt++;
+            if (*fmt == 'h')
+                fmt++;
+        } else if (*fmt == 'l') {
+            fmt++;
+            is_long = true;
+            if (*fmt == 'l') {
+                fmt++;
+                is_longlong = true;
+            }
+        }
+
+        switch (*fmt) {
+        case '%':
+            break;
+        case 'c':
+            dlog_put_u64(w, (uint64_t)va_arg(args, int));
+            break;
+        case 's':
+            dlog_put_string(w, va_arg(args, char *));
+            break;
+        case 'd':
+        case 'i':
+            if (is_longlong)
+                dlog_put_u64(w, (uint64_t)va_arg(args, long long));
+            else if (is_long)
+                dlog_put_u64(w, (uint64_t)va_arg(args, long));
+            else
+                dlog_put_u64(w, (uint64_t)(int64_t)va_arg(args, int));
+            break;
+        case 'b':
+        case 'B':
+        case 'o':
+        case 'x':
+        case 'X':
+        case 'u':
+            if (is_longlong)
+                dlog_put_u64(w, (uint64_t)va_arg(args, unsigned long long));
+            else if (is_long)
+                dlog_put_u64(w, (uint64_t)va_arg(args, unsigned long));
+            else
+                dlog_put_u64(w, (uint64_t)va_arg(args, unsigned int));
+            break;
+        case 'p':
+            dlog_put_u64(w, (uint64_t)(uintptr_t)va_arg(args, void *));
+            break;
+        default:
+            /* val_log() rejects the rest of the string; so does the decoder */
+            return flags;
+        }
+    }
+
+    return flags;
+}
+
+/**
+ *   @brief    - Records one message in the deferred log
+ *   @param    - verbosity  : Print Verbosity level
+ *             - fmt        : Format string as passed to val_printf
+ *             - args       : Arguments for fmt
+ *   @return   - None
+ **/
+static void dlog_capture(print_verbosity_t verbosity, const char *fmt, va_list args)
+{
+    dlog_writer_t w = { NULL, 2 * sizeof(uint32_t) };
+    uint32_t *hdr;
+    uint32_t flags;
+    uint64_t offset;
+    va_list size_args;
+
+    if (dlog.magic != DLOG_MAGIC) {
+        dlog.rodata_base = (uint64_t)(uintptr_t)__RODATA_START__;
+        dlog.magic = DLOG_MAGIC;
+    }
+
+    va_copy(size_args, args);
+    dlog_put_record(&w, fmt, size_args);
+    va_end(size_args);
+
+    offset = dlog_claim(w.pos);
+    if (offset == DLOG_NO_SPACE) {
+        __atomic_fetch_add(&dlog.dropped, 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    w.buf = &dlog.data[offset];
+    w.pos = 2 * sizeof(uint32_t);
+    flags = dlog_put_record(&w, fmt, args);
+
+    hdr = (uint32_t *)w.buf;
+    hdr[0] = (DLOG_REC_MAGIC << 24) | ((uint32_t)verbosity << 16) | flags;
+    hdr[1] = (uint32_t)w.pos;
+}
+
+/**
+ *   @brief    - Records a message in the deferred log without printing it.
+ *               Used by print paths that bypass val_printf (FAST_PRINT_ENABLE)
+ *   @param    - verbosity  : Print Verbosity level
+ *             - msg        : Input String
+ *             - ...        : ellipses for variadic args
+ *   @return   - None
+ **/
+void val_log_deferred(print_verbosity_t verbosity, const char *msg, ...)
+{
+    va_list args;
+
+    if ((msg == NULL) || !acs_policy_get_deferred_log())
+        return;
+
+    va_start(args, msg);
+    dlog_capture(verbosity, msg, args);
+    va_end(args);
+}
+
+static char *dlog_hex(char *out, uint64_t value, uint32_t digits)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    while (digits--)
+        *out++ = hex[(value >> (digits * 4)) & 0xF];
+
+    return out;
+}
+
+void val_log_deferred_dump(void)
+{
+    char line[96];
+    char *out;
+    uint64_t offset, i;
+
+    if (!acs_policy_get_deferred_log() || (dlog.magic != DLOG_MAGIC))
+        return;
+
+    /* ACS-DLOG-BEGIN <rodata base> <bytes used> <records dropped> */
+    out = line;
+    val_memcpy(out, "\r\nACS-DLOG-BEGIN ", 17);
+    out = dlog_hex(out + 17, dlog.rodata_base, 16);
+    *out++ = ' ';
+    out = dlog_hex(out, dlog.used, 16);
+    *out++ = ' ';
+    out = dlog_hex(out, dlog.dropped, 16);
+    val_memcpy(out, "\r\n", 3);
+    pal_print((uint64_t)(uintptr_t)line);
+
+    for (offset = 0; offset < dlog.used; offset += 32) {
+        out = line;
+        val_memcpy(out, "ACS-DLOG ", 9);
+        out += 9;
+        for (i = offset; (i < offset + 32) && (i < dlog.used); i++)
+            out = dlog_hex(out, dlog.data[i], 2);
+        val_memcpy(out, "\r\n", 3);
+        pal_print((uint64_t)(uintptr_t)line);
+    }
+
+    pal_print((uint64_t)(uintptr_t)"ACS-DLOG-END\r\n");
+}
+#else
+void val_log_deferred(print_verbosity_t verbosity, const char *msg, ...)
+{
+    (void)verbosity;
+    (void)msg;
+}
+
+void val_log_deferred_dump(void)
+{
+}
+#endif /* TARGET_BAREMETAL */
+
 /**
  *   @brief    - This function prints the given string and data onto the uart
  *   @param    - verbosity  : Print Verbosity level
@@ -690,6 +994,18 @@ uint32_t val_printf(print_verbosity_t verbosity, const char *msg, ...)
     if (msg == NULL)
         return 0;
 
+#if defined(TARGET_BAREMETAL)
+    if (acs_policy_get_deferred_log()) {
+        va_start(args, msg);
+        dlog_capture(verbosity, msg, args);
+        va_end(args);
+
+        /* Below the print level the message is only kept in the deferred log */
+        if (verbosity < (print_verbosity_t)acs_policy_get_print_level())
+            return 0;
+    }
+#endif
+
     collect_log_output = true;
     collected_log_len = 0;
     collected_log[0] = '\0';
@@ -821,6 +1137,5 @@ uint32_t val_printf(print_verbosity_t verbosity, const char *msg, ...)
 **/
 void val_mem_copy(char *dest, const char *src, size_t len)
 {
-    for (size_t i = 0; i < len; ++i)
-        dest[i] = src[i];
+    val_memcpy(dest, (void *)src, len);
 }
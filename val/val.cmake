@@ -51,6 +51,26 @@ function(acs_add_val_library)
     endif()
     list(REMOVE_DUPLICATES VAL_SRC)
 
+    # rule_alias_plan.c is generated from the alias tables in rule_metadata.c.
+    # The checked-in copy serves UEFI and Linux builds; here it is regenerated
+    # into the build directory when the metadata changes, so alias cycles are
+    # caught at build time without writing to the source tree.
+    find_package(Python3 COMPONENTS Interpreter QUIET)
+    if(Python3_Interpreter_FOUND)
+        set(ALIAS_PLAN_C ${CMAKE_CURRENT_BINARY_DIR}/rule_alias_plan.c)
+        list(REMOVE_ITEM VAL_SRC ${ROOT_DIR}/val/src/rule_alias_plan.c)
+        list(APPEND VAL_SRC ${ALIAS_PLAN_C})
+        add_custom_command(
+            OUTPUT ${ALIAS_PLAN_C}
+            COMMAND ${Python3_EXECUTABLE} ${ROOT_DIR}/tools/scripts/gen_alias_plan.py
+                    --output ${ALIAS_PLAN_C}
+            DEPENDS ${ROOT_DIR}/val/src/rule_metadata.c
+                    ${ROOT_DIR}/val/include/rule_based_execution.h
+                    ${ROOT_DIR}/tools/scripts/gen_alias_plan.py
+            COMMENT "Generating alias rule plan from rule_metadata.c"
+        )
+    endif()
+
     acs_append_compile_list(${VAL_SRC})
 
     add_library(${VAL_LIB} STATIC ${VAL_SRC})